@@ -0,0 +1,75 @@
+/*! \file feature_benchmark.cpp
+ *
+ * \brief Benchmark of the constructors of the feature location classes of features.hpp.
+ * \date October 14, 2026
+ * \warning This program is a research prototype only. It comes with
+ *  no warranty and no liability. Use it only at your own risk!
+ * \copyright This program is released under the Apache License 2.0.
+ */
+
+#include <iostream>
+#include <string>
+#include <chrono>
+#include <optional>
+#include "features.hpp"
+
+using namespace std;
+using namespace features;
+
+/*! Measures and returns the time that is required for calling work.
+ */
+template <class Work>
+double measure(Work work)
+{
+   const auto start { chrono::steady_clock::now() };
+   work();
+   return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+/*! Outputs a benchmark result as tab-separated values. The number of items
+    is the actual total number of features, the number of bits is the number
+    of features times the number of systems. Since the constructors write
+    nothing, there is no column for bytes per second.
+ */
+void print_benchmark(const string& name,const feature_location_t& spl,double seconds)
+{
+   const double s { max(seconds,1e-9) };
+   cout << name << separator << spl.M() << separator << spl.F() << separator << spl.T() << separator
+        << seconds << separator << seconds * 1e9 / spl.T() << separator
+        << static_cast<double>(spl.T()) * spl.S() / s << endl;
+}
+
+/*! Runs the benchmark cases for the constructors of feature_location_calculation_t,
+    feature_location_isolation_t, and feature_location_differences_t for
+    F = 1..n and model M, where feature_location_differences_t is limited to
+    F <= 4, since it enumerates 2^(2^F) set differences.
+    Usage: feature_benchmark [n [M [threads]]]
+ */
+int main(int argc,char* argv[])
+{
+   const feature_id_t n { static_cast<feature_id_t>(argc > 1 ? stoul(argv[1]) : 8) };
+   const model_id_t M { static_cast<model_id_t>(argc > 2 ? stoul(argv[2]) : complete_model) };
+   enumeration_options_t options { };
+   options.threads = argc > 3 ? stoul(argv[3]) : 1;
+   cout << "case" << separator << "parameter" << separator << "F" << separator << "items" << separator
+        << "seconds" << separator << "ns_per_item" << separator << "bits_per_second" << endl;
+   for (feature_id_t F { 1 }; F <= n; ++F)
+   {
+      {
+         optional<feature_location_calculation_t> spl;
+         const double seconds { measure([&] () { spl.emplace(F,M); }) };
+         print_benchmark("calculation",*spl,seconds);
+      }
+      {
+         optional<feature_location_isolation_t> spl;
+         const double seconds { measure([&] () { spl.emplace(F,M); }) };
+         print_benchmark("isolation",*spl,seconds);
+      }
+      if (F <= 4)
+      {
+         optional<feature_location_differences_t> spl;
+         const double seconds { measure([&] () { spl.emplace(F,M,options); }) };
+         print_benchmark("differences",*spl,seconds);
+      }
+   }
+}
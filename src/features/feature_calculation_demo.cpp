@@ -10,27 +10,175 @@
 #include <iostream>
 #include <fstream>
 #include <string>
+#include <map>
+#include <vector>
+#include <stdexcept>
+#include <optional>
 #include "features.hpp"
 
 using namespace std;
 using namespace features;
 
-int main()
+/*! Writes the results of spl to a CSV file and, if binary is true,
+    additionally to a binary file, or, if compressed is true,
+    to a file in the compressed variant of the binary format.
+ */
+void write_results(feature_location_calculation_t& spl,bool binary,bool compressed)
+{
+   string file_name { "feature_calculation_for_" + to_string(spl.F()) +
+                      "_model_" + to_string(spl.M()) + ".csv" };
+   async_ofstream_t output { file_name };
+   spl.print_header(output);
+   output << endl;
+   spl.print_systems(output);
+   output << endl;
+   spl.print_results(output);
+   output.close();
+   cout << "Results written to " << file_name << " ... Finished!" << endl;
+   if (binary || compressed)
+   {
+      string binary_file_name { file_name.substr(0,file_name.size() - 4) + (compressed ? ".rle" : ".bin") };
+      ofstream binary_output { binary_file_name,ios::binary };
+      spl.print_binary_results(binary_output,compressed);
+      cout << "Binary results written to " << binary_file_name << " ... Finished!" << endl;
+   }
+   if constexpr (instrumenting)
+   {
+      string report_file_name { file_name.substr(0,file_name.size() - 4) + ".json" };
+      ofstream report { report_file_name };
+      spl.print_report(report,"feature_calculation_demo");
+      cout << "Report written to " << report_file_name << " ... Finished!" << endl;
+   }
+}
+
+/*! Runs all jobs of a job file. Each job consists of a number of features
+    and a model id separated by white space. If several models are requested
+    for the same number of features, the complete model is calculated once
+    and the results of the requested models are derived from it.
+    If cache is not nullptr, the feature expressions of each job are taken
+    from the cache or stored in it instead.
+    If dry_run is true, the capacity plan of each job is printed instead.
+    Jobs that cannot finish according to their capacity plan are skipped.
+ */
+void run_batch(const string& job_file,bool binary,bool compressed,bool dry_run,const calibration_t& calibration,
+               const result_cache_t* cache)
 {
+   ifstream jobs { job_file };
+   if (!jobs)
+   {
+      throw runtime_error("Cannot open job file " + job_file);
+   }
+   map<feature_id_t,vector<model_id_t>> models;
+   feature_id_t number_of_features;
+   model_id_t model_id;
+   while (jobs >> number_of_features >> model_id)
+   {
+      models[number_of_features].push_back(model_id);
+   }
+   for (const auto& [f,m] : models)
+   {
+      if (dry_run)
+      {
+         for (const auto model : m)
+         {
+            capacity_plan_t { f,model,calibration }.print(cout);
+            cout << endl;
+         }
+         continue;
+      }
+      if (!preflight(capacity_plan_t { f,m.size() == 1 ? m.front() : complete_model,calibration },
+                     engine_t::calculation))
+      {
+         continue;
+      }
+      if (cache != nullptr)
+      {
+         for (const auto model : m)
+         {
+            feature_location_calculation_t spl { f,model,*cache };
+            write_results(spl,binary,compressed);
+         }
+         continue;
+      }
+      if (m.size() == 1)
+      {
+         feature_location_calculation_t spl { f,m.front() };
+         write_results(spl,binary,compressed);
+         continue;
+      }
+      const feature_location_calculation_t complete { f,complete_model };
+      for (const auto model : m)
+      {
+         feature_location_calculation_t spl { complete,model };
+         write_results(spl,binary,compressed);
+      }
+   }
+}
+
+int main(int argc,char* argv[])
+{
+   bool binary { false },
+        compressed { false },
+        dry_run { false };
+   calibration_t calibration { };
+   optional<result_cache_t> cache { };
+   string job_file { };
+   for (int i { 1 }; i < argc; ++i)
+   {
+      const string argument { argv[i] };
+      if (argument == "--binary")
+      {
+         binary = true;
+      }
+      else if (argument == "--compressed")
+      {
+         compressed = true;
+      }
+      else if (argument == "--dry-run")
+      {
+         dry_run = true;
+      }
+      else if (argument == "--calibration" && i + 1 < argc)
+      {
+         ifstream is { argv[++i] };
+         calibration = read_calibration(is);
+      }
+      else if (argument == "--cache" && i + 1 < argc)
+      {
+         cache.emplace(argv[++i]);
+      }
+      else if (argument == "--batch" && i + 1 < argc)
+      {
+         job_file = argv[++i];
+      }
+   }
+   if (!job_file.empty())
+   {
+      run_batch(job_file,binary,compressed,dry_run,calibration,cache ? &*cache : nullptr);
+      return 0;
+   }
    feature_id_t number_of_features;
    model_id_t model_id;
    cout << "Number of features: ";
    cin >> number_of_features;
    cout << "Model id: ";
    cin >> model_id;
+   const capacity_plan_t plan { number_of_features,model_id,calibration };
+   if (dry_run)
+   {
+      plan.print(cout);
+      return 0;
+   }
+   if (!preflight(plan,engine_t::calculation))
+   {
+      return 1;
+   }
+   if (cache)
+   {
+      feature_location_calculation_t spl { number_of_features,model_id,*cache };
+      write_results(spl,binary,compressed);
+      return 0;
+   }
    feature_location_calculation_t spl { number_of_features,model_id };
-   string file_name { "feature_calculation_for_" + to_string(number_of_features) +
-                      "_model_" + to_string(model_id) + ".csv" };
-   ofstream output { file_name };
-   spl.print_header(output);
-   output << endl;
-   spl.print_systems(output);
-   output << endl;
-   spl.print_results(output);
-   cout << "Results written to " << file_name << " ... Finished!" << endl;
+   write_results(spl,binary,compressed);
 }
@@ -10,27 +10,115 @@
 #include <iostream>
 #include <fstream>
 #include <string>
+#include <stdexcept>
 #include "features.hpp"
 
 using namespace std;
 using namespace features;
 
-int main()
+/*! Runs the program with the command line arguments. Throws
+    std::invalid_argument for an unknown argument.
+ */
+int run(int argc,char* argv[])
 {
+   bool binary { false },
+        compressed { false },
+        dry_run { false };
+   calibration_t calibration { };
+   enumeration_options_t options { };
+   for (int i { 1 }; i < argc; ++i)
+   {
+      const string argument { argv[i] };
+      if (argument == "--binary")
+      {
+         binary = true;
+      }
+      else if (argument == "--compressed")
+      {
+         compressed = true;
+      }
+      else if (argument == "--dry-run")
+      {
+         dry_run = true;
+      }
+      else if (argument == "--calibration" && i + 1 < argc)
+      {
+         ifstream is { argv[++i] };
+         calibration = read_calibration(is);
+      }
+      else if (argument == "--threads" && i + 1 < argc)
+      {
+         options.threads = stoul(argv[++i]);
+      }
+      else if (argument == "--chunk-size" && i + 1 < argc)
+      {
+         options.chunk_size = stoull(argv[++i]);
+      }
+      else if (argument == "--checkpoint" && i + 1 < argc)
+      {
+         options.checkpoint_file = argv[++i];
+      }
+      else
+      {
+         throw invalid_argument("Unknown argument " + argument);
+      }
+   }
    feature_id_t number_of_features;
    model_id_t model_id;
    cout << "Number of features: ";
    cin >> number_of_features;
    cout << "Model id: ";
    cin >> model_id;
-   feature_location_differences_t spl { number_of_features,model_id };
+   const capacity_plan_t plan { number_of_features,model_id,calibration };
+   if (dry_run)
+   {
+      plan.print(cout);
+      return 0;
+   }
+   if (!preflight(plan,engine_t::differences))
+   {
+      return 1;
+   }
+   feature_location_differences_t spl { number_of_features,model_id,options };
    string file_name { "feature_differences_for_" + to_string(number_of_features) +
                       "_model_" + to_string(model_id) + ".csv" };
-   ofstream output { file_name };
+   async_ofstream_t output { file_name };
    spl.print_header(output);
    output << endl;
    spl.print_systems(output);
    output << endl;
    spl.print_results(output);
+   output.close();
    cout << "Results written to " << file_name << " ... Finished!" << endl;
+   if (binary || compressed)
+   {
+      string binary_file_name { file_name.substr(0,file_name.size() - 4) + (compressed ? ".rle" : ".bin") };
+      ofstream binary_output { binary_file_name,ios::binary };
+      spl.print_binary_results(binary_output,compressed);
+      cout << "Binary results written to " << binary_file_name << " ... Finished!" << endl;
+   }
+   if constexpr (instrumenting)
+   {
+      string report_file_name { file_name.substr(0,file_name.size() - 4) + ".json" };
+      ofstream report { report_file_name };
+      spl.print_report(report,"feature_differences_demo");
+      cout << "Report written to " << report_file_name << " ... Finished!" << endl;
+   }
+   return 0;
+}
+
+/*! Runs the program and reports invalid arguments and checkpoint files
+    that belong to a different enumeration instead of aborting.
+ */
+int main(int argc,char* argv[])
+{
+   try
+   {
+      return run(argc,argv);
+   }
+   catch (const logic_error& e)
+   {
+      cerr << "Refused: " << e.what() << endl;
+      return 1;
+   }
 }
@@ -15,22 +15,55 @@
 using namespace std;
 using namespace features;
 
-int main()
+int main(int argc,char* argv[])
 {
+   bool dry_run { false };
+   calibration_t calibration { };
+   for (int i { 1 }; i < argc; ++i)
+   {
+      const string argument { argv[i] };
+      if (argument == "--dry-run")
+      {
+         dry_run = true;
+      }
+      else if (argument == "--calibration" && i + 1 < argc)
+      {
+         ifstream is { argv[++i] };
+         calibration = read_calibration(is);
+      }
+   }
    feature_id_t number_of_features;
    model_id_t model_id;
    cout << "Number of features: ";
    cin >> number_of_features;
    cout << "Model id: ";
    cin >> model_id;
+   const capacity_plan_t plan { number_of_features,model_id,calibration };
+   if (dry_run)
+   {
+      plan.print(cout);
+      return 0;
+   }
+   if (!preflight(plan,engine_t::isolation))
+   {
+      return 1;
+   }
    feature_location_isolation_t spl { number_of_features,model_id };
    string file_name { "feature_isolation_for_" + to_string(number_of_features) +
                       "_model_" + to_string(model_id) + ".csv" };
-   ofstream output { file_name };
+   async_ofstream_t output { file_name };
    spl.print_header(output);
    output << endl;
    spl.print_systems(output);
    output << endl;
    spl.print_results(output);
+   output.close();
    cout << "Results written to " << file_name << " ... Finished!" << endl;
+   if constexpr (instrumenting)
+   {
+      string report_file_name { file_name.substr(0,file_name.size() - 4) + ".json" };
+      ofstream report { report_file_name };
+      spl.print_report(report,"feature_isolation_demo");
+      cout << "Report written to " << report_file_name << " ... Finished!" << endl;
+   }
 }
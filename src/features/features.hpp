@@ -20,7 +20,36 @@
 #include <cstddef>
 #include <iostream>
 #include <climits>
+#include <bit> // because of std::popcount
+#include <span>
+#include <utility>
 #include <cstdint> // because of std::uintmax_t
+#include <cstring> // because of std::memcpy
+#include <string_view>
+#include <optional>
+#include <unordered_map>
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <iterator> // because of std::input_iterator_tag
+#include <array>
+#include <limits> // because of std::numeric_limits
+#include <charconv> // because of std::to_chars()
+#include <filesystem> // because of std::filesystem::path
+#include <memory> // because of std::unique_ptr
+#include <cctype> // because of std::isdigit()
+#include <random> // because of std::random_device
+#include <chrono> // because of std::chrono::steady_clock
+#include <ctime> // because of std::clock()
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h> // because of open()
+#include <sys/mman.h> // because of mmap()
+#include <sys/stat.h> // because of fstat()
+#include <unistd.h> // because of close()
+#include <sys/resource.h> // because of getrusage()
+#endif
 
 /*! This namespace contains all types and functions that are related
     to feature location.
@@ -55,36 +84,360 @@ namespace features
     */
    using maxnat_t      = uintmax_t;
 
+   /*! Packed collection of bits whose width is determined at runtime.
+       Bit s corresponds to system s + 1. Thus, a bitset_t of width S
+       can hold the set difference ID of any SPL, whereas maxnat_t
+       can only hold it for S <= 64, that is, F <= 6.
+       The bits are stored in 64-bit words, least significant word first.
+       Bits beyond size() in the last word are always kept zero.
+       The word-wise loops are kept simple, so that they can be
+       auto-vectorized by the compiler.
+    */
+   class bitset_t
+   {
+      public:
+         /*! Type alias for a single word of bits.
+          */
+         using word_t = std::uint64_t;
+         /*! Number of bits per word.
+          */
+         static constexpr std::size_t word_bits { 64 };
+         /*! Default constructor that creates a bitset_t of width 0.
+          */
+         bitset_t() = default;
+         /*! Constructor that requires the width and accepts an optional value
+             for initializing the least significant bits.
+          */
+         explicit bitset_t(std::size_t size,maxnat_t value = 0)
+            :m_size { size },
+             m_words((size + word_bits - 1) / word_bits,0)
+         {
+            if (!m_words.empty())
+            {
+               m_words.front() = value;
+               trim();
+            }
+         }
+         /*! Constructor that requires the width and the words that store the bits,
+             least significant word first.
+          */
+         bitset_t(std::size_t size,std::span<const word_t> words)
+            :m_size { size },
+             m_words(words.begin(),words.end())
+         {
+            if (m_words.size() != (size + word_bits - 1) / word_bits)
+            {
+               throw std::length_error("Number of words = " + std::to_string(m_words.size()) +
+                                       " does not match size = " + std::to_string(size) + "!");
+            }
+            trim();
+         }
+         /*! Returns the width in bits.
+          */
+         std::size_t size() const
+         {
+            return m_size;
+         }
+         /*! Returns the words that store the bits.
+          */
+         const std::vector<word_t>& words() const
+         {
+            return m_words;
+         }
+         /*! Returns true if bit i is set and false otherwise.
+          */
+         bool test(std::size_t i) const
+         {
+            return m_words[i / word_bits] >> (i % word_bits) & 1llu;
+         }
+         /*! Sets bit i to value.
+          */
+         void set(std::size_t i,bool value = true)
+         {
+            const word_t mask { 1llu << (i % word_bits) };
+            if (value)
+            {
+               m_words[i / word_bits] |= mask;
+            }
+            else
+            {
+               m_words[i / word_bits] &= ~mask;
+            }
+         }
+         /*! Returns the number of bits set.
+          */
+         std::size_t count() const
+         {
+            std::size_t result { 0 };
+            for (const auto& w : m_words)
+            {
+               result += std::popcount(w);
+            }
+            return result;
+         }
+         /*! Returns true if no bit is set and false otherwise.
+          */
+         bool none() const
+         {
+            word_t result { 0 };
+            for (const auto& w : m_words)
+            {
+               result |= w;
+            }
+            return result == 0;
+         }
+         /*! Performs bitwise-and assignment.
+          */
+         bitset_t& operator&=(const bitset_t& right)
+         {
+            check_size(right);
+            word_t* l { m_words.data() };
+            const word_t* r { right.m_words.data() };
+            for (std::size_t i { 0 }, n { m_words.size() }; i < n; ++i)
+            {
+               l[i] &= r[i];
+            }
+            return *this;
+         }
+         /*! Performs bitwise-or assignment.
+          */
+         bitset_t& operator|=(const bitset_t& right)
+         {
+            check_size(right);
+            word_t* l { m_words.data() };
+            const word_t* r { right.m_words.data() };
+            for (std::size_t i { 0 }, n { m_words.size() }; i < n; ++i)
+            {
+               l[i] |= r[i];
+            }
+            return *this;
+         }
+         /*! Performs bitwise-xor assignment.
+          */
+         bitset_t& operator^=(const bitset_t& right)
+         {
+            check_size(right);
+            word_t* l { m_words.data() };
+            const word_t* r { right.m_words.data() };
+            for (std::size_t i { 0 }, n { m_words.size() }; i < n; ++i)
+            {
+               l[i] ^= r[i];
+            }
+            return *this;
+         }
+         /*! Negates all bits in the range [0,size()).
+          */
+         bitset_t& flip()
+         {
+            word_t* l { m_words.data() };
+            for (std::size_t i { 0 }, n { m_words.size() }; i < n; ++i)
+            {
+               l[i] = ~l[i];
+            }
+            trim();
+            return *this;
+         }
+         /*! Returns bitwise negation.
+          */
+         friend bitset_t operator~(bitset_t b)
+         {
+            return b.flip();
+         }
+         /*! Returns bitwise-and of left and right.
+          */
+         friend bitset_t operator&(bitset_t left,const bitset_t& right)
+         {
+            return left &= right;
+         }
+         /*! Returns bitwise-or of left and right.
+          */
+         friend bitset_t operator|(bitset_t left,const bitset_t& right)
+         {
+            return left |= right;
+         }
+         /*! Returns bitwise-xor of left and right.
+          */
+         friend bitset_t operator^(bitset_t left,const bitset_t& right)
+         {
+            return left ^= right;
+         }
+         /*! Returns true if both bitsets have the same width and bits.
+          */
+         friend bool operator==(const bitset_t& left,const bitset_t& right) = default;
+         /*! Compares the values of both bitsets as unsigned numbers.
+          */
+         friend bool operator<(const bitset_t& left,const bitset_t& right)
+         {
+            left.check_size(right);
+            for (auto i { left.m_words.size() }; i > 0; --i)
+            {
+               if (left.m_words[i - 1] != right.m_words[i - 1])
+               {
+                  return left.m_words[i - 1] < right.m_words[i - 1];
+               }
+            }
+            return false;
+         }
+         /*! Returns the value of the bitset as decimal number.
+          */
+         std::string to_decimal() const
+         {
+            // The value is repeatedly divided by 10^19, which is
+            // the largest power of 10 that fits into a word.
+            constexpr word_t base { 10'000'000'000'000'000'000llu };
+            std::vector<word_t> dividend { m_words };
+            while (!dividend.empty() && dividend.back() == 0)
+            {
+               dividend.pop_back();
+            }
+            if (dividend.size() <= 1)
+            {
+               return std::to_string(dividend.empty() ? 0 : dividend.front());
+            }
+            std::vector<word_t> chunks;
+            while (!dividend.empty())
+            {
+               unsigned __int128 remainder { 0 };
+               for (auto i { dividend.size() }; i > 0; --i)
+               {
+                  remainder = remainder << word_bits | dividend[i - 1];
+                  dividend[i - 1] = static_cast<word_t>(remainder / base);
+                  remainder %= base;
+               }
+               chunks.push_back(static_cast<word_t>(remainder));
+               while (!dividend.empty() && dividend.back() == 0)
+               {
+                  dividend.pop_back();
+               }
+            }
+            std::string result { std::to_string(chunks.back()) };
+            for (auto i { chunks.size() - 1 }; i > 0; --i)
+            {
+               const auto chunk { std::to_string(chunks[i - 1]) };
+               result += std::string(19 - chunk.size(),'0') + chunk;
+            }
+            return result;
+         }
+      private:
+         /*! Clears the unused bits of the last word.
+          */
+         void trim()
+         {
+            if (const auto rest { m_size % word_bits }; rest != 0)
+            {
+               m_words.back() &= (1llu << rest) - 1llu;
+            }
+         }
+         /*! Throws if right differs in width.
+          */
+         void check_size(const bitset_t& right) const
+         {
+            if (m_size != right.m_size)
+            {
+               throw std::length_error("Bitset size = " + std::to_string(m_size) +
+                                       ", but " + std::to_string(right.m_size) +
+                                       " expected!");
+            }
+         }
+         std::size_t m_size { 0 };
+         std::vector<word_t> m_words;
+   };
+
    /*! Type alias for collection of feature names and associated
        set difference IDs.
     */
-   using feature_expression_t = std::vector<std::pair<std::string,maxnat_t>>;
+   using feature_expression_t = std::vector<std::pair<std::string,bitset_t>>;
    /*! Type alias for mapping a set difference ID to a feature name.
+       See expression_index_t for a hash index with the same purpose.
     */
-   using expression_feature_t = std::map<maxnat_t,std::string>;
+   using expression_feature_t = std::map<bitset_t,std::string>;
    /*! Type alias for a collection of feature names.
     */
    using feature_names_t      = std::vector<std::string>;
-   /*! Type alias for the feature names that define a system.
+   /*! Type alias for the ID of an interned feature name, that is,
+       its position in the feature table of a model.
+    */
+   using feature_index_t      = std::uint32_t;
+   /*! Type alias for a collection of interned feature IDs.
     */
-   using system_t             = feature_names_t;
+   using feature_indices_t    = std::vector<feature_index_t>;
+   /*! Type alias for the sorted IDs of the features that define a system.
+    */
+   using system_t             = feature_indices_t;
    /*! Type alias for a collection of systems that are defined
-       by their feature names.
+       by the IDs of their features.
     */
    using systems_t            = std::vector<system_t>;
+
+   /*! Table that interns feature names. Each name is stored once and
+       is identified by its position in the sorted table. Hence, comparing
+       feature IDs is the same as comparing feature names.
+    */
+   class feature_table_t
+   {
+      public:
+         /*! Default constructor that creates an empty table.
+          */
+         feature_table_t() = default;
+         /*! Constructor that takes all feature names, which need not be sorted.
+          */
+         explicit feature_table_t(feature_names_t names)
+            :m_names { std::move(names) }
+         {
+            std::sort(m_names.begin(),m_names.end());
+            m_names.erase(std::unique(m_names.begin(),m_names.end()),m_names.end());
+         }
+         /*! Returns the number of features.
+          */
+         std::size_t size() const
+         {
+            return m_names.size();
+         }
+         /*! Returns the name of the feature with ID i.
+          */
+         const std::string& name(feature_index_t i) const
+         {
+            return m_names.at(i);
+         }
+         /*! Returns the ID of the feature with the given name.
+             Throws if the name is not in the table.
+          */
+         feature_index_t id(const std::string& name) const
+         {
+            const auto p { std::lower_bound(m_names.cbegin(),m_names.cend(),name) };
+            if (p == m_names.cend() || *p != name)
+            {
+               throw std::logic_error(name + " is not a known feature.");
+            }
+            return static_cast<feature_index_t>(p - m_names.cbegin());
+         }
+         /*! Returns all names in the order of their IDs.
+          */
+         const feature_names_t& names() const
+         {
+            return m_names;
+         }
+      private:
+         feature_names_t m_names;
+   };
    
    /*! Represents a single set difference expression of systems.
+       Bit s is set if system s + 1 is intersected. All other systems
+       are united.
     */
    struct systems_difference_t
    {
-      /*! Names of the systems with features that must be intersected,
+      /*! Systems with features that must be intersected,
           that is, the left operand of the set difference.
        */
-      std::set<std::string> intersections,
-      /*! Names of the system with features that must be united,
+      bitset_t intersections;
+      /*! Returns the systems with features that must be united,
           that is, the right operand of the set difference.
        */
-                            unions;
+      bitset_t unions() const
+      {
+         return ~intersections;
+      }
    };
 
    /*! Represents a triple containing the set difference ID,
@@ -95,7 +448,7 @@ namespace features
    {
       /*! Set difference ID.
        */
-      maxnat_t difference_id;
+      bitset_t difference_id;
       /*! Name of the feature to be isolated.
        */
       std::string feature;
@@ -128,11 +481,225 @@ namespace features
       return n == 0llu ? 1llu : product(1llu,n);
    }
 
+   /*! Unsigned integer with 128 bits that records whether a calculation
+       has overflowed. It is used for counts that may not fit into maxnat_t,
+       so that a run can be planned before it is started.
+    */
+   class exact_count_t
+   {
+      public:
+         /*! Type alias for the type of the value.
+          */
+         using value_t = unsigned __int128;
+         /*! Default constructor that creates the count 0.
+          */
+         constexpr exact_count_t() = default;
+         /*! Constructor that creates the count value.
+          */
+         constexpr exact_count_t(maxnat_t value)
+            :m_value { value }
+         {
+         }
+         /*! Returns the count value.
+          */
+         static constexpr exact_count_t from_value(value_t value)
+         {
+            exact_count_t result { };
+            result.m_value = value;
+            return result;
+         }
+         /*! Returns a count that has overflowed.
+          */
+         static constexpr exact_count_t overflowed()
+         {
+            exact_count_t result { };
+            result.m_overflow = true;
+            return result;
+         }
+         /*! Returns true if the calculation of the count has overflowed.
+          */
+         constexpr bool overflow() const
+         {
+            return m_overflow;
+         }
+         /*! Returns the value, which is meaningless if overflow() is true.
+          */
+         constexpr value_t value() const
+         {
+            return m_value;
+         }
+         /*! Returns true if the count fits into maxnat_t.
+          */
+         constexpr bool fits() const
+         {
+            return !m_overflow && m_value <= std::numeric_limits<maxnat_t>::max();
+         }
+         /*! Returns the count as maxnat_t.
+             Throws std::overflow_error if it does not fit.
+          */
+         maxnat_t to_maxnat() const
+         {
+            if (!fits())
+            {
+               throw std::overflow_error(to_string() + " does not fit into maxnat_t.");
+            }
+            return static_cast<maxnat_t>(m_value);
+         }
+         /*! Returns the count as double, which is infinity if it has overflowed.
+          */
+         double to_double() const
+         {
+            return m_overflow ? std::numeric_limits<double>::infinity() : static_cast<double>(m_value);
+         }
+         /*! Returns the count as decimal number, or overflow.
+          */
+         std::string to_string() const
+         {
+            if (m_overflow)
+            {
+               return "overflow";
+            }
+            std::string result;
+            value_t v { m_value };
+            do
+            {
+               result.push_back(static_cast<char>('0' + v % 10));
+               v /= 10;
+            } while (v);
+            std::reverse(result.begin(),result.end());
+            return result;
+         }
+         /*! Returns the sum of left and right.
+          */
+         friend constexpr exact_count_t operator+(const exact_count_t& left,const exact_count_t& right)
+         {
+            if (left.m_overflow || right.m_overflow || left.m_value > ~value_t { 0 } - right.m_value)
+            {
+               return overflowed();
+            }
+            return from_value(left.m_value + right.m_value);
+         }
+         /*! Returns the product of left and right.
+          */
+         friend constexpr exact_count_t operator*(const exact_count_t& left,const exact_count_t& right)
+         {
+            if (left.m_overflow || right.m_overflow ||
+                (left.m_value != 0 && right.m_value > ~value_t { 0 } / left.m_value))
+            {
+               return overflowed();
+            }
+            return from_value(left.m_value * right.m_value);
+         }
+         /*! Returns the difference of left and right, which has overflowed if right is larger than left.
+          */
+         friend constexpr exact_count_t operator-(const exact_count_t& left,const exact_count_t& right)
+         {
+            if (left.m_overflow || right.m_overflow || left.m_value < right.m_value)
+            {
+               return overflowed();
+            }
+            return from_value(left.m_value - right.m_value);
+         }
+         /*! Returns the quotient of left and right rounded to the nearest lower integer.
+          */
+         friend constexpr exact_count_t operator/(const exact_count_t& left,maxnat_t right)
+         {
+            return left.m_overflow ? left : from_value(left.m_value / right);
+         }
+         /*! Compares both counts, where a count that has overflowed is larger than all others.
+          */
+         friend constexpr bool operator<(const exact_count_t& left,const exact_count_t& right)
+         {
+            if (left.m_overflow || right.m_overflow)
+            {
+               return !left.m_overflow && right.m_overflow;
+            }
+            return left.m_value < right.m_value;
+         }
+         /*! Inserts the count as decimal number into os.
+          */
+         friend std::ostream& operator<<(std::ostream& os,const exact_count_t& c)
+         {
+            return os << c.to_string();
+         }
+      private:
+         value_t m_value { 0 };
+         bool m_overflow { false };
+   };
+
+   /*! Returns 2 to the power of exponent as exact_count_t.
+    */
+   constexpr exact_count_t exact_power2(maxnat_t exponent)
+   {
+      if (exponent >= sizeof(exact_count_t::value_t) * CHAR_BIT)
+      {
+         return exact_count_t::overflowed();
+      }
+      return exact_count_t::from_value(exact_count_t::value_t { 1 } << exponent);
+   }
+
+   /*! Number of rows of the Pascal triangle whose entries all fit into maxnat_t.
+    */
+   constexpr maxnat_t pascal_rows { 68 };
+
+   /*! Returns the rows [0,pascal_rows) of the Pascal triangle.
+    */
+   constexpr std::array<std::array<maxnat_t,pascal_rows>,pascal_rows> make_pascal_table()
+   {
+      std::array<std::array<maxnat_t,pascal_rows>,pascal_rows> result { };
+      for (maxnat_t n { 0 }; n < pascal_rows; ++n)
+      {
+         result[n][0] = 1;
+         for (maxnat_t k { 1 }; k <= n; ++k)
+         {
+            result[n][k] = result[n - 1][k - 1] + result[n - 1][k];
+         }
+      }
+      return result;
+   }
+
+   /*! Pascal triangle that is calculated at compile time.
+       pascal_table[n][k] is the number of combinations of n items and sample size k.
+    */
+   constexpr auto pascal_table { make_pascal_table() };
+
+   /*! Returns number of combinations of n items and sample size k as exact_count_t.
+       Beyond the Pascal table, the intermediate products are checked for overflow.
+    */
+   constexpr exact_count_t exact_combinations(maxnat_t n,maxnat_t k)
+   {
+      if (k > n)
+      {
+         return 0;
+      }
+      if (n < pascal_rows)
+      {
+         return pascal_table[n][k];
+      }
+      k = std::min(k,n - k);
+      exact_count_t result { 1 };
+      for (maxnat_t i { 0 }; i < k && !result.overflow(); ++i)
+      {
+         // The product of i + 1 consecutive numbers is divisible by (i + 1)!.
+         result = result * exact_count_t { n - i } / (i + 1);
+      }
+      return result;
+   }
+
    /*! Returns number of combinations of n items and sample size k.
+       Throws std::overflow_error if the result does not fit into maxnat_t.
     */
    maxnat_t combinations(maxnat_t n,maxnat_t k)
    {
-      return product(n + 1llu - k,n) / factorial(k);
+      if (k > n)
+      {
+         return 0;
+      }
+      if (n < pascal_rows)
+      {
+         return pascal_table[n][k];
+      }
+      return exact_combinations(n,k).to_maxnat();
    }
 
    /*! Returns sum of combinations of n items in the sample range [k,n].
@@ -204,7 +771,7 @@ namespace features
 
    /*! Returns true if model M has or-features and false otherwise.
    */
-   bool hasO(model_id_t M)
+   constexpr bool hasO(model_id_t M)
    {
       return (M ==  2 || M ==  4 || M ==  6 || M ==  8 || M == 11 || M == 13 ||
               M == 14 || M == 16 || M == 17 || M == 19
@@ -213,7 +780,7 @@ namespace features
 
    /*! Returns true if model M has and-features and false otherwise.
    */
-   bool hasA(model_id_t M)
+   constexpr bool hasA(model_id_t M)
    {
       return (M ==  3 || M ==  4 || M ==  7 || M ==  8 || M == 12 || M == 13 ||
               M == 15 || M == 16 || M == 18 || M == 19
@@ -222,7 +789,7 @@ namespace features
 
    /*! Returns true if model M has not-features and false otherwise.
    */
-   bool hasN(model_id_t M)
+   constexpr bool hasN(model_id_t M)
    {
       return (M ==  5 || M ==  6 || M ==  7 || M ==  8 || M ==  9 || M == 10 ||
               M == 11 || M == 12 || M == 13 || M == 14 || M == 15 || 
@@ -232,7 +799,7 @@ namespace features
 
    /*! Returns true if model M has or-not-features and false otherwise.
    */
-   bool hasON(model_id_t M)
+   constexpr bool hasON(model_id_t M)
    {
       return (M ==  9 || M == 11 || M == 12 || M == 13 || M == 17 || 
               M == 18 || M == 19
@@ -241,104 +808,201 @@ namespace features
 
    /*! Returns true if model M has and-not-features and false otherwise.
    */
-   bool hasAN(model_id_t M)
+   constexpr bool hasAN(model_id_t M)
    {
       return (M == 10 || M == 14 || M == 15 || M == 16 || M == 17 ||
               M == 18 || M == 19
              );
    }
 
-   /*! Returns name for independent feature with id i.
+   /*! Model that has all categories of features. Its features
+       include the features of every other model.
+    */
+   constexpr model_id_t complete_model { 19 };
+
+   /*! Returns true if model M has all categories of features of model sub
+       and false otherwise.
    */
-   std::string independent_feature_name(feature_id_t i)
+   constexpr bool includes_model(model_id_t M,model_id_t sub)
    {
-      return feature + std::to_string(i); 
+      return (!hasO(sub) || hasO(M)) && (!hasA(sub) || hasA(M)) &&
+             (!hasN(sub) || hasN(M)) && (!hasON(sub) || hasON(M)) &&
+             (!hasAN(sub) || hasAN(M));
    }
 
-   /*! Returns name for or-feature of feature ids.
+   /*! Appends the decimal representation of n to result without
+       creating a temporary string.
    */
-   std::string or_feature_name(const std::vector<feature_id_t>& ids)
+   void append_number(std::string& result,maxnat_t n)
    {
-      std::string result { feature + std::to_string(ids.at(0)) };
-      for (std::size_t i { 1 }; i < ids.size(); ++i)
-      {
-         result = result + feature_separator + feature_or + feature_separator
-                         + feature 
-                         + std::to_string(ids.at(i));
-      }
-      return result;
+      std::array<char,std::numeric_limits<maxnat_t>::digits10 + 1> digits;
+      const auto [end,error] { std::to_chars(digits.data(),digits.data() + digits.size(),n) };
+      result.append(digits.data(),end);
    }
 
-   /*! Returns name for and-feature of feature ids.
+   /*! Appends name for feature with id i to result. Unless first is true,
+       the name is preceded by operation op. If negated is true, the name
+       is the one of the not-feature.
    */
-   std::string and_feature_name(const std::vector<feature_id_t>& ids)
+   void append_feature_term(std::string& result,feature_id_t i,const std::string& op,
+                            bool first,bool negated)
    {
-      std::string result { feature + std::to_string(ids.at(0)) };
-      for (std::size_t i { 1 }; i < ids.size(); ++i)
+      if (!first)
       {
-         result = result + feature_separator + feature_and + feature_separator
-                         + feature
-                         + std::to_string(ids.at(i));
+         result += feature_separator;
+         result += op;
+         result += feature_separator;
       }
-      return result;
-   }
+      if (negated)
+      {
+         result += feature_not;
+      }
+      result += feature;
+      append_number(result,i);
+   }
+
+   /*! Returns name for combination of the features with ids by operation op,
+       which are the not-features if negated is true.
+   */
+   std::string combined_feature_name(std::span<const feature_id_t> ids,const std::string& op,bool negated)
+   {
+      std::string result;
+      for (std::size_t i { 0 }; i < ids.size(); ++i)
+      {
+         append_feature_term(result,ids[i],op,i == 0,negated);
+      }
+      return result;
+   }
+
+   /*! Returns name for independent feature with id i.
+   */
+   std::string independent_feature_name(feature_id_t i)
+   {
+      return combined_feature_name(std::span(&i,1),feature_or,false);
+   }
+
+   /*! Returns name for or-feature of feature ids.
+   */
+   std::string or_feature_name(std::span<const feature_id_t> ids)
+   {
+      return combined_feature_name(ids,feature_or,false);
+   }
+
+   /*! Returns name for and-feature of feature ids.
+   */
+   std::string and_feature_name(std::span<const feature_id_t> ids)
+   {
+      return combined_feature_name(ids,feature_and,false);
+   }
 
    /*! Returns name for not-feature with id i.
    */
    std::string not_feature_name(feature_id_t i)
    {
-      return feature_not + feature + std::to_string(i); 
+      return combined_feature_name(std::span(&i,1),feature_or,true);
    }
 
    /*! Returns name for or-not-feature of feature ids.
    */
-   std::string or_not_feature_name(const std::vector<feature_id_t>& ids)
+   std::string or_not_feature_name(std::span<const feature_id_t> ids)
    {
-      std::string result { feature_not + feature + 
-                           std::to_string(ids.at(0)) };
-      for (std::size_t i { 1 }; i < ids.size(); ++i)
-      {
-         result = result + feature_separator + feature_or + feature_separator
-                         + feature_not 
-                         + feature + std::to_string(ids.at(i));
-      }
-      return result;
+      return combined_feature_name(ids,feature_or,true);
    }
 
    /*! Returns name for and-not-feature of feature ids.
    */
-  std::string and_not_feature_name(const std::vector<feature_id_t>& ids)
+   std::string and_not_feature_name(std::span<const feature_id_t> ids)
    {
-      std::string result { feature_not + feature +
-                           std::to_string(ids.at(0)) };
-      for (std::size_t i { 1 }; i < ids.size(); ++i)
-      {
-         result = result + feature_separator + feature_and + feature_separator
-                         + feature_not 
-                         + feature + std::to_string(ids.at(i));
-      }
-      return result;
+      return combined_feature_name(ids,feature_and,true);
    }
 
+   /*! Class that builds the names of the combinations of features, which are
+       created by combination_t one after another, for example, by or_feature_name().
+       The name of the last combination is kept. Consecutive combinations share
+       a prefix, whose names are reused, so only the names of the changed suffix
+       are rewritten.
+   */
+   class feature_name_buffer_t
+   {
+      public:
+         /*! Constructor that requires the operation, which combines the features,
+             and whether they are the not-features.
+          */
+         feature_name_buffer_t(const std::string& op,bool negated)
+            :m_op { op },
+             m_negated { negated }
+         {
+         }
+         /*! Returns the name of the combination of the features with ids,
+             which remains valid until the next call.
+          */
+         const std::string& operator()(std::span<const feature_id_t> ids)
+         {
+            std::size_t valid { 0 };
+            while (valid < ids.size() && valid < m_ids.size() && ids[valid] == m_ids[valid])
+            {
+               ++valid;
+            }
+            m_ids.assign(ids.begin(),ids.end());
+            m_ends.resize(ids.size());
+            m_name.resize(valid > 0 ? m_ends[valid - 1] : 0);
+            for (std::size_t i { valid }; i < ids.size(); ++i)
+            {
+               append_feature_term(m_name,ids[i],m_op,i == 0,m_negated);
+               m_ends[i] = m_name.size();
+            }
+            return m_name;
+         }
+      private:
+         std::string m_op;
+         bool m_negated;
+         std::vector<feature_id_t> m_ids;
+         std::vector<std::size_t> m_ends;
+         std::string m_name;
+   };
+
    /*! Returns name for system with id n.
    */
-   std::string system_name(feature_id_t n)
+   std::string system_name(maxnat_t n)
    {
-      return system + std::to_string(n);
+      std::string result { system };
+      append_number(result,n);
+      return result;
+   }
+
+   /*! Function that returns the successor of i in the lexicographic order
+       of the decimal representations of the natural numbers in the range [1,n],
+       or 0 if i is the last one. This is the order of the system names.
+       For example, the order for n = 12 is 1, 10, 11, 12, 2, 3, ..., 9.
+    */
+   maxnat_t next_lexicographic(maxnat_t i,maxnat_t n)
+   {
+      if (i <= n / 10)
+      {
+         return i * 10;
+      }
+      while (i % 10 == 9 || i >= n)
+      {
+         if ((i /= 10) == 0)
+         {
+            return 0;
+         }
+      }
+      return i + 1;
    }
 
    /*! Returns name for system set difference expression with id n.
    */
-   std::string difference_name(feature_id_t n)
+   std::string difference_name(const bitset_t& n)
    {
-      return difference_expression + std::to_string(n);
+      return difference_expression + n.to_decimal();
    }
 
    /*! Returns value of or-feature for ids and feature expression idf.
    */
-   maxnat_t or_feature_value(const std::vector<feature_id_t>& ids,const feature_expression_t& idf)
+   bitset_t or_feature_value(std::span<const feature_id_t> ids,const feature_expression_t& idf)
    {
-      maxnat_t result { 0 };
+      bitset_t result(idf.at(0).second.size());
       for (const auto& v : ids)
       {
          result |= idf.at(v - 1).second;
@@ -348,9 +1012,9 @@ namespace features
 
    /*! Returns value of and-feature for ids and feature expression idf.
    */
-   maxnat_t and_feature_value(const std::vector<feature_id_t>& ids,const feature_expression_t& idf)
+   bitset_t and_feature_value(std::span<const feature_id_t> ids,const feature_expression_t& idf)
    {
-      maxnat_t result { ~0ull };
+      bitset_t result { ~bitset_t(idf.at(0).second.size()) };
       for (const auto& v : ids)
       {
          result &= idf.at(v - 1).second;
@@ -360,9 +1024,9 @@ namespace features
 
    /*! Returns value of or-not-feature for ids and feature expression nf.
    */
-   maxnat_t or_not_feature_value(const std::vector<feature_id_t>& ids,const feature_expression_t& nf)
+   bitset_t or_not_feature_value(std::span<const feature_id_t> ids,const feature_expression_t& nf)
    {
-      maxnat_t result { 0 };
+      bitset_t result(nf.at(0).second.size());
       for (const auto& v : ids)
       {
          result |= nf.at(v - 1).second;
@@ -372,9 +1036,9 @@ namespace features
 
    /*! Returns value of and-not-feature for ids and feature expression nf.
    */
-   maxnat_t and_not_feature_value(const std::vector<feature_id_t>& ids,const feature_expression_t& nf,const maxnat_t& bitmask)
+   bitset_t and_not_feature_value(std::span<const feature_id_t> ids,const feature_expression_t& nf,const bitset_t& bitmask)
    {
-      maxnat_t result { ~bitmask };
+      bitset_t result { ~bitmask };
       for (const auto& v : ids)
       {
          result &= nf.at(v - 1).second;
@@ -397,7 +1061,23 @@ namespace features
       return result;
    }
 
+   /*! Function that returns the natural number whose bit i - 1 is set
+       for each raw feature ID i in v, that is, the inverse of unsigned2vector().
+    */
+   maxnat_t vector2unsigned(std::span<const feature_id_t> v)
+   {
+      maxnat_t result { 0 };
+      for (const auto i : v)
+      {
+         result |= 1ull << (i - 1);
+      }
+      return result;
+   }
+
    /*! Class template that generates all combinations of size k for symbols.
+       The combinations are generated in lexicographic order of the
+       positions of the symbols. Stepping through them with next()
+       does not allocate memory.
    */
    template <class T>
    class combination_t
@@ -405,13 +1085,13 @@ namespace features
       public:
          /*! Constructor that accepts a vector with symbols and size k.
          */
-         combination_t(const std::vector<T> symbols,std::size_t k)
-            :m_symbols(symbols),m_k(k)
+         combination_t(std::vector<T> symbols,std::size_t k)
+            :m_symbols(std::move(symbols)),m_k(k)
          {
-            if (k > symbols.size())
+            if (k > m_symbols.size())
             {
                throw std::logic_error("n = " + 
-                                      std::to_string(symbols.size()) + 
+                                      std::to_string(m_symbols.size()) + 
                                       ", k = " + std::to_string(k) +
                                       " violates n >= k!\n"
                                      );
@@ -423,8 +1103,11 @@ namespace features
          void initialize()
          {
             std::size_t start { };
+            m_state.clear();
+            m_current.clear();
             for (auto i { k() }; i > 0; --i)
             {
+               m_current.push_back(m_symbols[start]);
                m_state.push_back(start++);
             }
          };
@@ -434,21 +1117,29 @@ namespace features
          {
             return m_k;
          }
+         /*! Returns the number of symbols.
+         */
+         std::size_t n() const
+         {
+            return m_symbols.size();
+         }
          /*! Returns true, if a succeeding state is available for the combination.
          */
          bool next()
          {
             for (auto i { m_state.size() }; i > 0; --i)
             {
-               auto v { m_state.at(i - 1) };
+               auto v { m_state[i - 1] };
                if (v < m_symbols.size() &&
                    v + 1 + k() - i < m_symbols.size() 
                   )
                {
-                 m_state.at(i - 1) += 1;
+                 m_state[i - 1] += 1;
+                 m_current[i - 1] = m_symbols[m_state[i - 1]];
                  for (auto j { i }; j < m_state.size(); ++j)
                  {
-                    m_state.at(j) = m_state.at(j - 1) + 1;
+                    m_state[j] = m_state[j - 1] + 1;
+                    m_current[j] = m_symbols[m_state[j]];
                  }
                  return true;
                }
@@ -460,1091 +1151,4086 @@ namespace features
          */
          std::vector<T> operator()() const
          {
-           std::vector<T> result;
-           for (const auto& e : m_state)
-           {
-              result.push_back(m_symbols.at(e));
-           }
-           return result;
-         }
-      private:
-         std::vector<T> m_symbols;
-         std::vector <std::size_t> m_state;
-         std::size_t m_k;
-   };
-
-   /*! Base class for all classes that perform feature location.
-    */
-   class feature_location_t
-   {
-      public:
-         /*! Constructor that requires the number of idependent features
-             and the number of the model as parameters.
-          */
-         feature_location_t(feature_id_t n_,
-                            feature_id_t m_)
-              :m_n { n_ },
-               m_F { n_ },
-               m_M { m_ },
-               m_S { power2(n_) },
-               m_O { hasO(m_) ? sum_of_combinations(n_,2) : 0 },
-               m_A { hasA(m_) ? sum_of_combinations(n_,2) : 0 },
-               m_N { hasN(m_) ? n_ : 0u },
-               m_ON { hasON(m_) ? sum_of_combinations(n_,2) : 0 },
-               m_AN { hasAN(m_) ? sum_of_combinations(n_,2) : 0 },
-               m_I { (hasO(m_) ? sum_of_combinations(n_,2) : 0) +
-                     (hasA(m_) ? sum_of_combinations(n_,2) : 0) +
-                     (hasN(m_) ? n_ : 0) +
-                     (hasAN(m_) ? sum_of_combinations(n_,2) : 0) +
-                     (hasON(m_) ? sum_of_combinations(n_,2) : 0)
-                   },
-               m_T { n_ +
-                     (hasO(m_) ? sum_of_combinations(n_,2) : 0) +
-                     (hasA(m_) ? sum_of_combinations(n_,2) : 0) +
-                     (hasN(m_) ? n_ : 0) +
-                     (hasAN(m_) ? sum_of_combinations(n_,2) : 0) +
-                     (hasON(m_) ? sum_of_combinations(n_,2) : 0)
-                   },
-               m_D { power2(power2(n_)) }
-         {
-            for (std::size_t i { 1 }; i <= m_n; ++i)
-            {
-               m_raw_independent_features.push_back(i);
-            }
-            for (std::size_t i { 2 }; i <= m_n; ++i)
-            {
-               combination_t c(raw_independent_features(),i);
-               do
-               {
-                  m_raw_dependent_features.push_back(c());
-               } while (c.next());
-            }
-            m_all_systems = generate_all_systems();
-         }
-         /*! Returns the number of independent features, same as F().
-          */
-         const auto& n() const
-         {
-            return m_n;
+           return m_current;
          }
-         /*! Returns the number of independent features, same as n().
+         /*! Returns a span with the symbols of the actual combination.
+             The span remains valid for the lifetime of the combination
+             and reflects the state after next() or unrank().
          */
-         const auto& F() const
+         std::span<const T> symbols() const
          {
-            return m_F;
+           return m_current;
          }
-         /*! Returns the number of systems of SPL.
+         /*! Returns a span with the positions of the symbols of the
+             actual combination.
          */
-         const auto& S() const
+         std::span<const std::size_t> state() const
          {
-            return m_S;
+           return m_state;
          }
-         /*! Returns the number of selected model.
+         /*! Returns the number of all combinations.
          */
-         const auto& M() const
+         maxnat_t count() const
          {
-            return m_M;
+            return combinations(n(),k());
          }
-         /*! Returns the actual number of or-features.
+         /*! Returns the position of the actual combination in the
+             order of next(), using the combinatorial number system.
+             The result is in the range [0,count()).
          */
-         const auto& O() const
+         maxnat_t rank() const
          {
-            return m_O;
+            maxnat_t result { count() - 1 };
+            for (std::size_t i { 0 }; i < k(); ++i)
+            {
+               result -= binomial(n() - 1 - m_state[i],k() - i);
+            }
+            return result;
          }
-         /*! Returns the actual number of and-features.
+         /*! Sets the actual combination to the one with rank r.
+             This is the inverse of rank(). Thus, the combinations
+             can be split into contiguous ranges of ranks.
          */
-         const auto& A() const
+         void unrank(maxnat_t r)
          {
-            return m_A;
+            if (r >= count())
+            {
+               throw std::logic_error("r = " + std::to_string(r) +
+                                      " violates r < " + std::to_string(count()) +
+                                      "!\n");
+            }
+            maxnat_t x { count() - 1 - r };
+            std::size_t a { n() };
+            for (std::size_t i { 0 }; i < k(); ++i)
+            {
+               do
+               {
+                  --a;
+               } while (binomial(a,k() - i) > x);
+               x -= binomial(a,k() - i);
+               m_state[i] = n() - 1 - a;
+               m_current[i] = m_symbols[m_state[i]];
+            }
          }
-         /*! Returns the actual number of not-features.
+      private:
+         /*! Returns binomial coefficient of n and k, which is 0 for k > n.
          */
-         const auto& N() const
+         static maxnat_t binomial(maxnat_t n,maxnat_t k)
          {
-            return m_N;
+            return k > n ? 0 : combinations(n,k);
          }
-         /*! Returns actual number of or-not-features.
-         */
-         const auto& ON() const
+         std::vector<T> m_symbols;
+         std::vector <std::size_t> m_state;
+         std::vector<T> m_current;
+         std::size_t m_k;
+   };
+
+   /*! Identifies files in the binary format.
+    */
+   const std::string binary_magic { "FLBITS01" };
+
+   /*! Identifies files in the compressed variant of the binary format.
+    */
+   const std::string compressed_magic { "FLRLE001" };
+
+   /*! Header of a file in the binary format. The file contains
+       difference expressions plus the names of the features
+       they isolate. All numbers are stored little-endian.
+       The header is followed by count difference expressions at
+       data_offset, each occupying stride bytes. A difference expression
+       consists of the words of a bitset_t, least significant word first,
+       so that bit s corresponds to system s + 1.
+       The names start at names_offset. They consist of count + 1
+       64-bit positions, relative to the first character, followed by
+       the concatenated characters of the names.
+       In the compressed variant, each difference expression is a record
+       of variable size, see append_compressed(). The records are followed
+       by an index at index_offset, which consists of count + 1 64-bit
+       positions of the records relative to data_offset, so that each
+       record can be found without decoding the others.
+    */
+   struct binary_header_t
+   {
+      /*! Always binary_magic, or compressed_magic in the compressed variant.
+       */
+      char magic[8];
+      /*! Number of independent features.
+       */
+      std::uint64_t F;
+      /*! Model id.
+       */
+      std::uint64_t M;
+      /*! Symbol of the feature category padded with zeros,
+          for example "AN", or "ALL" if the file contains all categories.
+       */
+      char category[8];
+      /*! Number of systems, that is, number of bits per difference expression.
+       */
+      std::uint64_t S;
+      /*! Number of difference expressions.
+       */
+      std::uint64_t count;
+      /*! Number of bytes per difference expression.
+       */
+      std::uint64_t stride;
+      /*! Position of the first difference expression.
+       */
+      std::uint64_t data_offset;
+      /*! Position of the names.
+       */
+      std::uint64_t names_offset;
+      /*! Number of bytes of the names.
+       */
+      std::uint64_t names_size;
+      /*! Position of the index of the records in the compressed variant, otherwise 0.
+       */
+      std::uint64_t index_offset;
+      /*! Reserved for future use, always 0.
+       */
+      std::uint64_t reserved[5];
+   };
+   static_assert(sizeof(binary_header_t) == 128);
+   static_assert(std::endian::native == std::endian::little,
+                 "The binary format requires a little-endian platform.");
+
+   /*! Returns header for the binary format.
+       Takes number of independent features, model id, category,
+       number of systems, number of difference expressions,
+       and number of bytes of the names.
+    */
+   binary_header_t make_binary_header(maxnat_t F,model_id_t M,const std::string& category,
+                                      maxnat_t S,maxnat_t count,maxnat_t names_size)
+   {
+      if (category.size() >= sizeof(binary_header_t::category))
+      {
+         throw std::length_error(category + " is not a valid category.");
+      }
+      binary_header_t result { };
+      std::memcpy(result.magic,binary_magic.data(),sizeof(result.magic));
+      std::memcpy(result.category,category.data(),category.size());
+      result.F = F;
+      result.M = M;
+      result.S = S;
+      result.count = count;
+      result.stride = (S + bitset_t::word_bits - 1) / bitset_t::word_bits * sizeof(bitset_t::word_t);
+      result.data_offset = sizeof(binary_header_t);
+      result.names_offset = result.data_offset + count * result.stride;
+      result.names_size = (count + 1) * sizeof(std::uint64_t) + names_size;
+      return result;
+   }
+
+   /*! Tag of a record of the compressed variant of the binary format
+       whose words are stored unchanged.
+    */
+   constexpr char raw_record { 0 };
+
+   /*! Tag of a record of the compressed variant of the binary format
+       whose words are stored as runs.
+    */
+   constexpr char run_record { 1 };
+
+   /*! Appends n to buffer as variable-length number, seven bits per byte,
+       least significant first. The high bit of a byte is set if another byte follows.
+    */
+   void append_varint(std::string& buffer,std::uint64_t n)
+   {
+      for (; n >= 0x80; n >>= 7)
+      {
+         buffer += static_cast<char>((n & 0x7F) | 0x80);
+      }
+      buffer += static_cast<char>(n);
+   }
+
+   /*! Appends the words of a difference expression as record of the compressed
+       variant of the binary format to buffer. A record starts with its tag. The
+       words of a run_record consist of runs, where each run is a variable-length
+       number of repetitions followed by the repeated word. Since the independent
+       features are periodic and their combinations consist of long runs, most
+       difference expressions shrink to a few runs. If the runs require more space
+       than the words, the words are stored unchanged in a raw_record.
+    */
+   void append_compressed(std::string& buffer,std::span<const bitset_t::word_t> words)
+   {
+      const std::size_t start { buffer.size() },
+                        limit { start + 1 + words.size_bytes() };
+      buffer += run_record;
+      for (std::size_t w { 0 }; w < words.size() && buffer.size() <= limit; )
+      {
+         std::size_t n { 1 };
+         while (w + n < words.size() && words[w + n] == words[w])
          {
-            return m_ON;
+            ++n;
          }
-         /*! Returns actual number of and-not-features.
-         */
-         const auto& AN() const
+         append_varint(buffer,n);
+         buffer.append(reinterpret_cast<const char*>(&words[w]),sizeof(bitset_t::word_t));
+         w += n;
+      }
+      if (buffer.size() > limit)
+      {
+         buffer.resize(start);
+         buffer += raw_record;
+         buffer.append(reinterpret_cast<const char*>(words.data()),words.size_bytes());
+      }
+   }
+
+   /*! Decodes a record of the compressed variant of the binary format into words.
+       Throws if the record does not contain exactly words.size() words.
+    */
+   void decompress_record(std::string_view record,std::span<bitset_t::word_t> words)
+   {
+      const auto invalid { [] () { return std::runtime_error("Invalid compressed record!"); } };
+      if (record.empty())
+      {
+         throw invalid();
+      }
+      if (record.front() == raw_record)
+      {
+         if (record.size() != 1 + words.size_bytes())
          {
-            return m_AN;
+            throw invalid();
          }
-         /*! Returns the actual number of inherently dependent features.
-         */
-         const auto& DF() const
+         std::memcpy(words.data(),record.data() + 1,words.size_bytes());
+         return;
+      }
+      if (record.front() != run_record)
+      {
+         throw invalid();
+      }
+      std::size_t p { 1 },
+                  w { 0 };
+      while (p < record.size())
+      {
+         std::uint64_t n { 0 };
+         for (unsigned shift { 0 }; ; shift += 7)
          {
-            return m_I;
+            if (p >= record.size() || shift >= 64)
+            {
+               throw invalid();
+            }
+            const auto byte { static_cast<unsigned char>(record[p++]) };
+            n |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+            if (!(byte & 0x80))
+            {
+               break;
+            }
          }
-         /*! Returns the actual total number of features.
-         */
-         const auto& T() const
+         bitset_t::word_t value;
+         if (n == 0 || n > words.size() - w || record.size() - p < sizeof(value))
          {
-            return m_T;
+            throw invalid();
          }
-         /*! Returns the number of all possible set differences of SPL systems.
-         */
-         const auto& D() const
+         std::memcpy(&value,record.data() + p,sizeof(value));
+         p += sizeof(value);
+         std::fill_n(words.begin() + w,n,value);
+         w += n;
+      }
+      if (w != words.size())
+      {
+         throw invalid();
+      }
+   }
+
+   /*! Prints items in the binary format. Takes output stream, number of
+       independent features, model id, category, number of systems, items,
+       functions that return the name and the difference expression of an item,
+       and whether the compressed variant is to be printed as parameters.
+       The stream should have been opened in binary mode.
+    */
+   template <class Items,class Name,class Value>
+   void print_binary_items(std::ostream& os,maxnat_t F,model_id_t M,const std::string& category,
+                           maxnat_t S,const Items& items,Name name,Value value,bool compressed)
+   {
+      maxnat_t names_size { 0 };
+      for (const auto& item : items)
+      {
+         if (value(item).size() != S)
          {
-            return m_D;
+            throw std::length_error("Set difference of " + name(item) + " has wrong size!");
          }
-         /*! Creates and returns a collection with all names of independent features.
-             Takes raw feature IDs for single system.
-          */
-         feature_names_t generate_independent_features(const std::vector<feature_id_t>& f) const
+         names_size += name(item).size();
+      }
+      auto header { make_binary_header(F,M,category,S,items.size(),names_size) };
+      std::string records;
+      std::vector<std::uint64_t> index { 0 };
+      if (compressed)
+      {
+         for (const auto& item : items)
          {
-            std::vector<std::string> result;
-            for (const auto& i : f)
-            {
-               result.push_back(independent_feature_name(i));
-            }
-            return result;
+            append_compressed(records,value(item).words());
+            index.push_back(records.size());
          }
-         /*! Creates and returns a collection with all names of or-features.
-             Takes raw feature IDs for single system.
-          */
-         feature_names_t generate_or_features(const std::vector<feature_id_t>& f) const
+         std::memcpy(header.magic,compressed_magic.data(),sizeof(header.magic));
+         header.index_offset = header.data_offset + records.size();
+         header.names_offset = header.index_offset + index.size() * sizeof(std::uint64_t);
+      }
+      os.write(reinterpret_cast<const char*>(&header),sizeof(header));
+      if (compressed)
+      {
+         os.write(records.data(),records.size());
+         os.write(reinterpret_cast<const char*>(index.data()),index.size() * sizeof(std::uint64_t));
+      }
+      else
+      {
+         for (const auto& item : items)
          {
-            std::vector<std::string> result;
-            if (hasO(M()))
-            {
-              for (auto i : f)
-              {
-                 for (const auto& j : raw_dependent_features())
-                 if (auto t { or_feature_name(j) };
-                     (contains(j,i) && !contains(result,t))
-                    )
-                 {
-                    result.push_back(t);
-                 }
-              }
-              sort(result.begin(),result.end());
-            }
-            return result;
+            os.write(reinterpret_cast<const char*>(value(item).words().data()),header.stride);
          }
-         /*! Creates and returns a collection with all names of and-features.
-             Takes raw feature IDs for single system.
+      }
+      std::uint64_t position { 0 };
+      for (const auto& item : items)
+      {
+         os.write(reinterpret_cast<const char*>(&position),sizeof(position));
+         position += name(item).size();
+      }
+      os.write(reinterpret_cast<const char*>(&position),sizeof(position));
+      for (const auto& item : items)
+      {
+         os << name(item);
+      }
+   }
+
+   /*! Prints set differences in the binary format.
+       Takes output stream, number of independent features, model id,
+       category, number of systems, set differences, and whether the
+       compressed variant is to be printed as parameters.
+       The stream should have been opened in binary mode.
+    */
+   void print_binary(std::ostream& os,maxnat_t F,model_id_t M,const std::string& category,
+                     maxnat_t S,const differences_t& differences,bool compressed = false)
+   {
+      print_binary_items(os,F,M,category,S,differences,
+                         [] (const auto& d) -> const std::string& { return d.feature; },
+                         [] (const auto& d) -> const bitset_t& { return d.difference_id; },
+                         compressed);
+   }
+
+   /*! Prints feature expressions in the binary format.
+       Takes output stream, number of independent features, model id,
+       category, number of systems, feature expressions, and whether the
+       compressed variant is to be printed as parameters.
+       The stream should have been opened in binary mode.
+    */
+   void print_binary(std::ostream& os,maxnat_t F,model_id_t M,const std::string& category,
+                     maxnat_t S,const feature_expression_t& expressions,bool compressed = false)
+   {
+      print_binary_items(os,F,M,category,S,expressions,
+                         [] (const auto& e) -> const std::string& { return e.first; },
+                         [] (const auto& e) -> const bitset_t& { return e.second; },
+                         compressed);
+   }
+
+   /*! Class that provides read access to a file in the binary format
+       or in its compressed variant. On Unix-like systems, the file is
+       memory-mapped, so that opening it does not read the difference
+       expressions. Otherwise, the file is read into memory.
+       In the compressed variant, a single difference expression is
+       found by the index and decoded on request.
+    */
+   class binary_results_t
+   {
+      public:
+         /*! Type alias for a single word of a difference expression.
+          */
+         using word_t = bitset_t::word_t;
+         /*! Constructor that requires the name of the file.
           */
-         feature_names_t generate_and_features(const std::vector<feature_id_t>& f) const
+         explicit binary_results_t(const std::string& file_name)
          {
-            std::vector<std::string> result;
-            if (hasA(M()))
+#if defined(__unix__) || defined(__APPLE__)
+            const int fd { ::open(file_name.c_str(),O_RDONLY) };
+            if (fd < 0)
             {
-               for (const auto& i : raw_dependent_features())
-               {
-                  bool valid { true };
-                  for (auto j : i)
-                  {
-                     if (!contains(f,j))
-                     {
-                        valid = false;
-                        break;
-                     }
-                  }
-                  if (valid)
-                  {
-                     result.push_back(and_feature_name(i));
-                  }
-               }
-               sort(result.begin(),result.end());
+               throw std::runtime_error(file_name + " cannot be opened.");
             }
-            return result;
-         }
-         /*! Creates and returns a collection with all names of not-features.
-             Takes raw feature IDs for single system.
-          */
-         feature_names_t generate_not_features(const std::vector<feature_id_t>& nf) const
-         {
-            std::vector<std::string> result;
-            if (hasN(M()))
+            struct stat status { };
+            if (::fstat(fd,&status) != 0 || status.st_size < static_cast<off_t>(sizeof(binary_header_t)))
             {
-               auto f { negate(nf,n()) };
-               for (const auto& i : f)
-               {
-                  result.push_back(not_feature_name(i));
-               }
+               ::close(fd);
+               throw std::runtime_error(file_name + " is not a binary results file.");
             }
-            return result;
-         }
-         /*! Creates and returns a collection with all names of or-not-features.
-             Takes raw feature IDs for single system.          
-          */
-         feature_names_t generate_or_not_features(const std::vector<feature_id_t>& nf) const
-         {
-            std::vector<std::string> result;
-            if (hasON(M()))
+            m_size = status.st_size;
+            void* p { ::mmap(nullptr,m_size,PROT_READ,MAP_SHARED,fd,0) };
+            ::close(fd);
+            if (p == MAP_FAILED)
             {
-               auto f { negate(nf,n()) };
-               for (auto i : f)
-               {
-                  for (const auto& j : raw_dependent_features())
-                  if (auto t { or_not_feature_name(j) };
-                      (contains(j,i) && !contains(result,t))
-                     )
-                  {
-                     result.push_back(t);
-                  }
-              }
-              sort(result.begin(),result.end());
+               throw std::runtime_error(file_name + " cannot be mapped.");
             }
-            return result;
-         }
-         /*! Creates and returns a collection with all names of and-not-features.
-             Takes raw feature IDs for single system.
-          */
-         feature_names_t generate_and_not_features(const std::vector<feature_id_t>& nf) const 
-         {
-            std::vector<std::string> result;
-            if (hasAN(M()))
+            m_data = static_cast<const char*>(p);
+#else
+            std::ifstream is { file_name,std::ios::binary };
+            m_buffer.assign(std::istreambuf_iterator<char>(is),std::istreambuf_iterator<char>());
+            m_data = m_buffer.data();
+            m_size = m_buffer.size();
+#endif
+            std::memcpy(&m_header,m_data,std::min(m_size,sizeof(m_header)));
+            const std::string_view magic(m_header.magic,sizeof(m_header.magic));
+            m_compressed = magic == compressed_magic;
+            const std::uint64_t data_end { m_compressed ? m_header.index_offset + (m_header.count + 1) * sizeof(std::uint64_t)
+                                                        : m_header.data_offset + m_header.count * m_header.stride };
+            if (m_size < sizeof(m_header) ||
+                (magic != binary_magic && !m_compressed) ||
+                m_header.names_offset + m_header.names_size > m_size ||
+                (m_compressed && m_header.index_offset < m_header.data_offset) ||
+                data_end > m_header.names_offset ||
+                m_header.stride % sizeof(word_t) != 0 ||
+                m_header.stride * CHAR_BIT < m_header.S ||
+                m_header.names_size < (m_header.count + 1) * sizeof(std::uint64_t))
             {
-               auto f { negate(nf,n()) };
-               for (const auto& i : raw_dependent_features())
-               {
-                  bool valid { true };
-                  for (auto j : i)
-                  {
-                     if (!contains(f,j))
-                     {
-                        valid = false;
-                        break;
-                     }
-                  }
-                  if (valid)
-                  {
-                     result.push_back(and_not_feature_name(i));
-                  }
-               }
-               sort(result.begin(),result.end());
+               unmap();
+               throw std::runtime_error(file_name + " is not a binary results file.");
+            }
+            m_positions = m_data + m_header.names_offset;
+            m_names = m_data + m_header.names_offset + (m_header.count + 1) * sizeof(std::uint64_t);
+            m_records = m_compressed ? m_data + m_header.index_offset : nullptr;
+            if (position(m_header.count) > m_header.names_size - (m_header.count + 1) * sizeof(std::uint64_t) ||
+                (m_compressed && record(m_header.count) > m_header.index_offset - m_header.data_offset))
+            {
+               unmap();
+               throw std::runtime_error(file_name + " is not a binary results file.");
             }
-            return result;
          }
-         /*! Creates and returns all feature names that define a system. 
-             Takes raw feature IDs for single system.
+         binary_results_t(const binary_results_t&) = delete;
+         binary_results_t& operator=(const binary_results_t&) = delete;
+         /*! Destructor that unmaps the file.
           */
-         system_t generate_system(const std::vector<feature_id_t>& f)  const
+         ~binary_results_t()
          {
-            std::vector<std::string> result;
-            concat(result,generate_independent_features(f));
-            concat(result,generate_or_features(f));
-            concat(result,generate_and_features(f));
-            concat(result,generate_not_features(f));
-            concat(result,generate_or_not_features(f));
-            concat(result,generate_and_not_features(f));
-            sort(result.begin(),result.end());
-            return result;
+            unmap();
          }
-         /*! Returns a collection of all systems of the SPL.
+         /*! Returns the header of the file.
           */
-         systems_t generate_all_systems() const 
+         const binary_header_t& header() const
          {
-            std::vector<std::vector<std::string>> result;
-            for (maxnat_t s { 0 }; s < S(); ++s)
-            {
-               result.push_back(generate_system(unsigned2vector(s)));
-            }
-            return result;
+            return m_header;
          }
-         /*! Returns a collection with raw independent feature IDs. 
+         /*! Returns the number of independent features.
           */
-         const std::vector<feature_id_t>& raw_independent_features() const
+         maxnat_t F() const
          {
-            return m_raw_independent_features;
+            return m_header.F;
          }
-         /*! Returns a collection with collection of raw feature IDs that
-             represents dependent features (with the exception of not-features).
+         /*! Returns the model id.
           */
-         const std::vector<std::vector<feature_id_t>>& raw_dependent_features() const
+         maxnat_t M() const
          {
-            return m_raw_dependent_features;
+            return m_header.M;
          }
-         /*! Returns a collection wjth all systems.
+         /*! Returns the number of systems.
           */
-         const auto& all_systems() const
+         maxnat_t S() const
          {
-            return m_all_systems;
+            return m_header.S;
          }
-         /*! Prints header for results of feature location analysis.
-             Takes output stream as parameter with std::cout as default value.
+         /*! Returns the symbol of the feature category.
           */
-         void print_header(std::ostream& os = std::cout)
+         std::string category() const
          {
-            os << "M" << M() << separator << "selected model\n"
-               << T() << separator << "T" << separator << "actual total number of features\n"
-               << F() << separator << "F" << separator << "number of independent features\n"
-               << DF() << separator << "DF" << separator << "actual total number of inherently dependent features\n"
-               << O() << separator << "O" << separator << "actual number of or-features\n"
-               << A() << separator << "A" << separator << "actual number of and-features\n"
-               << N() << separator << "N" << separator << "actual number of not-features\n"
-               << ON() << separator << "ON" << separator << "actual number of or-not-features\n"
-               << AN() << separator << "AN" << separator << "actual number of and-not-features\n"
-               << S() << separator << "S" << separator << "number of systems of SPL\n"
-               << D() << separator << "D" << separator << "number of all set differences of SPL systems\n";
+            const std::string_view category(m_header.category,sizeof(m_header.category));
+            return std::string(category.substr(0,category.find('\0')));
          }
-
-         /*! Prints all systems with the features that define them.
-             Takes output stream as parameter with std::cout as default value.
+         /*! Returns the number of difference expressions.
           */
-         void print_systems(std::ostream& os = std::cout)
+         std::size_t size() const
          {
-            for (maxnat_t i { 0 };const auto & system : all_systems())
-            {
-               os << system_name(++i) << separator;
-               for (const auto& feature : system)
-               {
-                  os << feature << separator;
-               }
-               os << std::endl;
-            }
+            return m_header.count;
          }
-     private:
-         const feature_id_t  m_n;
-         const maxnat_t m_F;
-         const feature_id_t m_M;
-
-         const maxnat_t m_S,
-                        m_O,
-                        m_A,
-                        m_N,
-                        m_ON,
-                        m_AN,
-                        m_I,
-                        m_T,
-                        m_D;
-         std::vector<feature_id_t> m_raw_independent_features;
-         std::vector<std::vector<feature_id_t>> m_raw_dependent_features;
-         std::vector<feature_names_t> m_all_systems;
-   };
-
-   /*! Class that performs feature location analysis
-       based on feature isolation. In this approach,
-       no IDs for set differences are created.
-    */
-   class feature_location_isolation_t: public feature_location_t
-   {
-      public:
-         /*! Constructor that requires the number of independent features
-             and the number of the model as parameters.
+         /*! Returns the name of the feature that is isolated by
+             difference expression i.
           */
-         feature_location_isolation_t(feature_id_t n_,
-                                      feature_id_t m_)
-              :feature_location_t(n_,m_)
-         { 
-            m_independent_features = generate_independent_features();
-            m_or_features = generate_or_features();
-            m_and_features = generate_and_features();
-            m_not_features = generate_not_features();
-            m_or_not_features = generate_or_not_features();
-            m_and_not_features = generate_and_not_features();
-            m_all_features.reserve(m_all_features.size()
-                                   + m_independent_features.size()
-                                   + m_or_features.size()
-                                   + m_and_features.size()
-                                   + m_not_features.size()
-                                   + m_or_not_features.size()
-                                   + m_and_not_features.size()
-                                 );
-            concat(concat(concat(concat(concat(concat(m_all_features,
-                   m_independent_features),m_or_features),m_and_features),
-                   m_not_features),m_or_not_features),m_and_not_features
-                  );
-            std::sort(m_all_features.begin(),m_all_features.end());
-            m_feature_isolations = generate_feature_isolations();
+         std::string_view name(std::size_t i) const
+         {
+            check_index(i);
+            const auto first { position(i) };
+            return std::string_view(m_names + first,position(i + 1) - first);
          }
-         /*! Creates and returns a collection with all names of 
-             independent features of all systems of the SPL.
+         /*! Returns true if the file is in the compressed variant of the binary format.
           */
-         feature_names_t generate_independent_features() const
+         bool compressed() const
          {
-            return feature_location_t::generate_independent_features(raw_independent_features());
+            return m_compressed;
          }
-         /*! Creates and returns a collection with all names of 
-             or-features of all systems of the SPL.
+         /*! Returns the words of difference expression i without copying them.
+             Throws in the compressed variant, whose words must be decoded by expression().
           */
-         feature_names_t generate_or_features() const
+         std::span<const word_t> words(std::size_t i) const
          {
-            feature_names_t result;
-            if (hasO(M()))
+            check_index(i);
+            if (m_compressed)
             {
-               for (feature_id_t k { 2 }; k <= n(); ++k)
-               {
-                  combination_t combination { raw_independent_features(),k };
-                  do 
-                  {
-                     result.push_back(or_feature_name(combination()));
-                  } while (combination.next());
-               }
+               throw std::logic_error("The words of a compressed file must be decoded by expression()!");
             }
-            return result;
+            return std::span<const word_t>(reinterpret_cast<const word_t*>(m_data + m_header.data_offset +
+                                                                          i * m_header.stride),
+                                           (m_header.S + bitset_t::word_bits - 1) / bitset_t::word_bits);
          }
-         /*! Creates and returns a collection with all names of 
-             and-features of all systems of the SPL.
+         /*! Returns difference expression i as bitset_t.
           */
-         feature_names_t generate_and_features() const
+         bitset_t expression(std::size_t i) const
          {
-            feature_names_t result;
-            if (hasA(M()))
+            if (!m_compressed)
             {
-               for (feature_id_t k { 2 }; k <= n(); ++k)
-               {
-                  combination_t combination { raw_independent_features(),k };
-                  do 
-                  {
-                     result.push_back(and_feature_name(combination()));
-                  } while (combination.next());
-               }
+               return bitset_t(S(),words(i));
             }
-            return result;
-         }
-         /*! Creates and returns a collection with all names of 
-             not-features of all systems of the SPL.
-          */
-         feature_names_t generate_not_features() const
-         {
-            feature_names_t result;
-            if (hasN(M()))
+            check_index(i);
+            const auto first { record(i) },
+                       last { record(i + 1) };
+            if (first > last || last > record(size()))
             {
-               for (const auto& i : raw_independent_features())            {
-                  result.push_back(not_feature_name(i));
-               }
+               throw std::runtime_error("Invalid index of compressed records!");
             }
-            return result;
+            std::vector<word_t> result((S() + bitset_t::word_bits - 1) / bitset_t::word_bits);
+            decompress_record(std::string_view(m_data + m_header.data_offset + first,last - first),result);
+            return bitset_t(S(),result);
          }
-         /*! Creates and returns a collection with all names of 
-             or-not-features of all systems of the SPL.
+         /*! Returns the index of the difference expression that isolates
+             feature with name, if there is one. The first call creates
+             an index of all names.
           */
-         feature_names_t generate_or_not_features() const
+         std::optional<std::size_t> find(std::string_view name) const
          {
-            feature_names_t result;
-            if (hasON(M()))
+            if (m_index.empty())
             {
-               for (feature_id_t k { 2 }; k <= N(); ++k)
+               m_index.reserve(size());
+               for (std::size_t i { 0 }; i < size(); ++i)
                {
-                  combination_t combination { raw_independent_features(),k };
-                  do 
-                  {
-                     result.push_back(or_not_feature_name(combination()));
-                  } while (combination.next());
+                  m_index.emplace(this->name(i),i);
                }
             }
-            return result;
-         }
-         /*! Creates and returns a collection with all names of 
-             and-not-features of all systems of the SPL.
-          */
-         feature_names_t generate_and_not_features() const
-         {
-            feature_names_t result;
-            if (hasAN(M()))
+            if (const auto p { m_index.find(name) }; p != m_index.end())
             {
-               for (feature_id_t k { 2 }; k <= N(); ++k)
-               {
-                  combination_t combination { raw_independent_features(),k };
-                  do 
-                  {
-                     result.push_back(and_not_feature_name(combination()));
-                  } while (combination.next());
-               }
+               return p->second;
             }
-            return result;
+            return std::nullopt;
          }
-         /*! Returns collection with all independent features.
+      private:
+         /*! Throws if i is not a valid index.
           */
-         const feature_names_t& independent_features() const
+         void check_index(std::size_t i) const
          {
-            return m_independent_features;
+            if (i >= size())
+            {
+               throw std::out_of_range("Index = " + std::to_string(i) + ", but size = " +
+                                       std::to_string(size()) + "!");
+            }
          }
-         /*! Returns collection with all or-features.
+         /*! Returns value i of an array of 64-bit values in the file. The value is
+             copied, since the records of the compressed variant have different
+             lengths, so that the arrays after them are not necessarily aligned.
           */
-         const std::vector<std::string>& or_features() const
+         static std::uint64_t load(const char* values,std::size_t i)
          {
-            return m_or_features;
+            std::uint64_t result;
+            std::memcpy(&result,values + i * sizeof(result),sizeof(result));
+            return result;
          }
-         /*! Returns collection with all and-features.
+         /*! Returns the position of name i within the names.
           */
-         const std::vector<std::string>& and_features() const
+         std::uint64_t position(std::size_t i) const
          {
-            return m_and_features;
+            return load(m_positions,i);
          }
-         /*! Returns collection with all not-features.
+         /*! Returns the position of record i within the records of the compressed variant.
           */
-         const std::vector<std::string>& not_features() const
+         std::uint64_t record(std::size_t i) const
          {
-            return m_not_features;
+            return load(m_records,i);
          }
-         /*! Returns collection with all or-not-features.
+         /*! Releases the file contents.
           */
-         const std::vector<std::string>& or_not_features() const
+         void unmap()
          {
-            return m_or_not_features;
+#if defined(__unix__) || defined(__APPLE__)
+            if (m_data != nullptr)
+            {
+               ::munmap(const_cast<char*>(m_data),m_size);
+            }
+#endif
+            m_data = nullptr;
          }
-         /*! Returns collection with all and-not-features.
+         const char* m_data { nullptr };
+         std::size_t m_size { 0 };
+#if !(defined(__unix__) || defined(__APPLE__))
+         std::vector<char> m_buffer;
+#endif
+         binary_header_t m_header { };
+         bool m_compressed { false };
+         const char* m_records { nullptr };
+         const char* m_positions { nullptr };
+         const char* m_names { nullptr };
+         mutable std::unordered_map<std::string_view,std::size_t> m_index;
+   };
+
+   /*! Version of the calculation of the feature expressions. It is part of the
+       key of each entry of a result_cache_t. Increment it whenever a change alters
+       the results, so that the entries of older versions are not used anymore.
+    */
+   constexpr unsigned engine_version { 1 };
+
+   /*! Persistent cache of feature expressions in a directory. Each entry is a file
+       in the binary format that contains the feature expressions of one category.
+       Its name is derived from the key, which consists of engine_version, the number
+       of independent features, the model id, and the symbol of the category, for example
+       v1_F10_M19_AN.bin. Entries are found by their key and memory-mapped, so that they
+       are not calculated again. Entries of other versions are removed when the cache
+       is opened.
+    */
+   class result_cache_t
+   {
+      public:
+         /*! Constructor that requires the directory, which is created if it does not exist.
           */
-         const std::vector<std::string>& and_not_features() const
+         explicit result_cache_t(const std::filesystem::path& directory)
+            :m_directory { directory }
          {
-            return m_and_not_features;
+            std::filesystem::create_directories(m_directory);
+            const std::string own { "v" + std::to_string(engine_version) + "_" };
+            for (const auto& entry : std::filesystem::directory_iterator(m_directory))
+            {
+               const std::string name { entry.path().filename().string() };
+               if (entry.is_regular_file() && name.size() > 1 && name.front() == 'v' &&
+                   std::isdigit(static_cast<unsigned char>(name[1])) && !name.starts_with(own) &&
+                   name.ends_with(".bin"))
+               {
+                  std::filesystem::remove(entry.path());
+               }
+            }
          }
-         /*! Returns collection with all features.
+         /*! Returns the directory of the cache.
           */
-         const std::vector<std::string>& all_features() const
+         const std::filesystem::path& directory() const
          {
-            return m_all_features;
+            return m_directory;
          }
-         /*! Returns collection with all feature isolations.
+         /*! Returns the path of the entry with the key of F, M, and category.
           */
-         const features_isolation_t& feature_isolations() const
+         std::filesystem::path path(maxnat_t F,model_id_t M,const std::string& category) const
          {
-            return m_feature_isolations;
+            return m_directory / ("v" + std::to_string(engine_version) + "_F" + std::to_string(F) +
+                                  "_M" + std::to_string(M) + "_" + category + ".bin");
          }
-         /*! Creates and returns collection with all feature isolations.
+         /*! Returns the memory-mapped entry with the key of F, M, and category,
+             or nullptr if there is none. An entry whose header does not match
+             its key is removed.
           */
-         features_isolation_t generate_feature_isolations() const
+         std::unique_ptr<binary_results_t> find(maxnat_t F,model_id_t M,const std::string& category) const
          {
-            features_isolation_t result;
-            for (const auto& f : all_features())
+            const auto p { path(F,M,category) };
+            if (!std::filesystem::exists(p))
+            {
+               return nullptr;
+            }
+            try
             {
-               systems_difference_t difference;
-               maxnat_t system_no { 0 };
-               for (const auto& s: all_systems())
+               auto result { std::make_unique<binary_results_t>(p.string()) };
+               if (result->F() == F && result->M() == M && result->category() == category)
                {
-                  ++system_no;
-                  if (contains(s,f))
-                  {
-                     difference.intersections.insert(system_name(system_no));
-                  }
-                  else
-                  {
-                    difference.unions.insert(system_name(system_no));
-                  }
+                  return result;
                }
-               result.insert(std::make_pair(f,difference));
             }
-            return result;
-         }   
-         /*! Prints intersection part, that is the left operand, of set difference.
-             Takes output stream as parameter with std::cout as default value.
+            catch (const std::runtime_error&)
+            {
+            }
+            std::filesystem::remove(p);
+            return nullptr;
+         }
+         /*! Stores feature expressions with S systems as the entry with the key
+             of F, M, and category. The entry is written to a temporary file
+             that is renamed afterwards, so that an interrupted or concurrent
+             run never finds an incomplete entry.
           */
-         void print_intersections(const std::set<std::string>& s,std::ostream& os = std::cout) const
+         void store(maxnat_t F,model_id_t M,const std::string& category,maxnat_t S,
+                    const feature_expression_t& expressions) const
          {
-           std::size_t counter { },
-                       size { s.size() };
-            os << opening_parenthesis << set_separator;
-            for (const auto& e : s)
+            const auto p { path(F,M,category) };
+            auto temporary { p };
+            temporary += ".tmp" + std::to_string(std::random_device { }());
             {
-               os << e;
-               if (++counter < size)
+               std::ofstream os { temporary,std::ios::binary };
+               print_binary(os,F,M,category,S,expressions);
+               if (!os.flush())
                {
-                  os << set_separator << set_intersection << set_separator;
+                  throw std::runtime_error(temporary.string() + " cannot be written.");
                }
             }
-            os << set_separator << closing_parenthesis;
+            std::filesystem::rename(temporary,p);
          }
-         /*! Prints union part, that is the right operand, of set difference.
-             Takes output stream as parameter with std::cout as default value.
+      private:
+         std::filesystem::path m_directory;
+   };
+
+   /*! Bit matrix with systems as rows and features as columns.
+       Bit f of row s is set if system s + 1 contains the feature with ID f
+       of the feature table. Each row occupies the same number of words.
+    */
+   class membership_matrix_t
+   {
+      public:
+         /*! Type alias for a single word of a row.
           */
-         void print_unions(const std::set<std::string>& s,std::ostream& os = std::cout) const
+         using word_t = bitset_t::word_t;
+         /*! Constructor that requires the systems and the number of features.
+          */
+         membership_matrix_t(const systems_t& systems,std::size_t features)
+            :m_rows { systems.size() },
+             m_columns { features },
+             m_words_per_row { (features + bitset_t::word_bits - 1) / bitset_t::word_bits },
+             m_words(m_rows * m_words_per_row,0)
          {
-            std::size_t counter { },
-                        size { s.size() };
-            os << opening_parenthesis << set_separator;
-            for (const auto& e : s)
+            for (std::size_t s { 0 }; s < systems.size(); ++s)
             {
-               os << e;
-               if (++counter < size)
+               for (const auto f : systems[s])
                {
-                  os << set_separator << set_union << set_separator;
-               }
+                  if (f >= features)
+                  {
+                     throw std::logic_error(std::to_string(f) + " is not a known feature.");
+                  }
+                  set(s,f);
+               }
             }
-            os << set_separator << closing_parenthesis;
          }
-         /*! Prints results of feature isolation.
-             Takes output stream as parameter with std::cout as default value.
+         /*! Returns the number of rows, that is, the number of systems.
           */
-         void print_results(std::ostream& os = std::cout) const
+         std::size_t rows() const
          {
-            for (const auto& e : feature_isolations())
-            {
-               os << e.first << separator;
-               print_intersections(e.second.intersections,os);
-               os << set_separator << set_difference << set_separator;
-               print_unions(e.second.unions,os);
-               os << std::endl;
-            }
+            return m_rows;
          }
-      private:
-         std::vector<std::string> m_independent_features,
-                                  m_or_features,
-                                  m_and_features,
-                                  m_not_features,
-                                  m_or_not_features,
-                                  m_and_not_features,
-                                  m_all_features;
-         features_isolation_t     m_feature_isolations;
-   };
-
-   /*! Class that performs feature location analysis
-       by calculating all set differences. In this approach,
-       IDs for set differences are created.
-    */
-  class feature_location_differences_t: public feature_location_isolation_t
-   {
-      public:
-         /*! Constructor that requires the number of idependent features
-             and the number of the model as parameters.
+         /*! Returns the number of columns, that is, the number of features.
           */
-         feature_location_differences_t(feature_id_t n_,
-                                        feature_id_t m_)
-              :feature_location_isolation_t(n_,m_)
-         { 
-            m_non_empty_differences = generate_non_empty_differences();
+         std::size_t columns() const
+         {
+            return m_columns;
          }
-         /*! Takes a string containing all defining features of a system
-             and returs a set of all features that define the system.
+         /*! Returns the number of words per row.
           */
-         std::set<std::string> system2features(std::string s) const
+         std::size_t words_per_row() const
          {
-            if (s.length() < system.length() + 1 || s.find(system) != 0)
-            {
-               throw std::logic_error(s + " is not a system identifier.");
-            }
-            std::set<std::string> result;
-            std::size_t pos { stoull(s.erase(0,system.size())) };
-            for (const auto& f : all_systems().at(pos - 1))
-            {
-               result.insert(f);
-            }
-            return result;
+            return m_words_per_row;
          }
-         /*! Calculates and returns a set difference expression
-             for a single system.
-             Takes total number of systems as parameter.
+         /*! Returns the words of row s.
           */
-         systems_difference_t generate_difference(maxnat_t s) const
+         std::span<const word_t> row(std::size_t s) const
          {
-            systems_difference_t result;
-            for (maxnat_t position { 0 }; position < S(); ++position)
-            {
-               if (s & 1ull << position)
-               {
-                  result.intersections.insert(system_name(position + 1));
-               }
-               else
-               {
-                  result.unions.insert(system_name(position + 1));
-               }
-            }
-            return result;
+            return std::span<const word_t>(m_words.data() + s * m_words_per_row,m_words_per_row);
          }
-         /*! Evaluates the intersection part of a set difference and
-             returns the result.
-             Takes a set difference as parameter.
+         /*! Returns true if bit f of row s is set.
           */
-         std::set<std::string> evaluate_intersections(const systems_difference_t& diff) const
+         bool test(std::size_t s,std::size_t f) const
          {
-            std::set<std::string> result;
-            if (diff.intersections.size() >= 1)
-            {
-               auto first { diff.intersections.cbegin() };
-               result = system2features(*first);
-               while (++first != diff.intersections.end())
-               {
-                  auto left { result };
-                  auto right { system2features(*first) };
-                  result.clear();
-                  std::set_intersection(left.begin(),left.end(),
-                                        right.begin(),right.end(),
-                                        std::inserter(result,result.begin()));
-                  if (result.size() == 0)
-                  {
-                     break;
-                  }
-               }
-            }
-            return result;
+            return row(s)[f / bitset_t::word_bits] >> (f % bitset_t::word_bits) & 1llu;
          }
-         /*! Evaluates the union part of a set difference and
-             returns the result.
-             Takes a set difference as parameter.
+         /*! Returns the transposed matrix, that is, a matrix with features as
+             rows and systems as columns. Row f of the result holds the
+             systems that contain the feature with ID f.
           */
-         std::set<std::string> evaluate_unions(const systems_difference_t& diff) const
+         membership_matrix_t transpose() const
          {
-            std::set<std::string> result;
-            if (diff.unions.size() >= 1)
+            membership_matrix_t result { m_columns,m_rows };
+            for (std::size_t s { 0 }; s < m_rows; ++s)
             {
-               auto first { diff.unions.cbegin() };
-               result = system2features(*first);
-               while (++first != diff.unions.end())
+               const auto r { row(s) };
+               for (std::size_t i { 0 }; i < m_words_per_row; ++i)
                {
-                  auto left { result };
-                  auto right { system2features(*first) };
-                  result.clear();
-                  std::set_union(left.begin(),left.end(),
-                                 right.begin(),right.end(),
-                                 std::inserter(result,result.begin()));
+                  for (word_t w { r[i] }; w != 0; w &= w - 1)
+                  {
+                     result.set(i * bitset_t::word_bits + std::countr_zero(w),s);
+                  }
                }
             }
             return result;
          }
-         /*! Evaluates a set difference and returns the result.
-             Takes the set difference as parameter.
+      private:
+         /*! Constructor that creates an empty matrix with the given numbers
+             of rows and columns.
           */
-         std::set<std::string> evaluate_difference(const systems_difference_t& diff) const
+         membership_matrix_t(std::size_t rows,std::size_t columns)
+            :m_rows { rows },
+             m_columns { columns },
+             m_words_per_row { (columns + bitset_t::word_bits - 1) / bitset_t::word_bits },
+             m_words(m_rows * m_words_per_row,0)
+         {}
+         /*! Sets bit f of row s.
+          */
+         void set(std::size_t s,std::size_t f)
          {
-            auto intersections { evaluate_intersections(diff) };
-            auto unions { evaluate_unions(diff) };
-            std::set<std::string> result;
-            std::set_difference(intersections.begin(),intersections.end(),
-                                unions.begin(),unions.end(),
-                                std::inserter(result,result.begin()));
-
-            return result;
+            m_words[s * m_words_per_row + f / bitset_t::word_bits] |= 1llu << (f % bitset_t::word_bits);
          }
-         differences_t generate_non_empty_differences() const
+         std::size_t m_rows,
+                     m_columns,
+                     m_words_per_row;
+         std::vector<word_t> m_words;
+   };
+
+   /*! Class that evaluates set differences of systems with a membership matrix.
+       The set difference with ID e intersects all systems whose bit is set in e
+       and unites all other systems. Thus, its evaluation consists of bitwise and
+       and or operations on the rows of the matrix, followed by a popcount.
+       Each thread requires its own exemplar.
+    */
+   class difference_evaluator_t
+   {
+      public:
+         /*! Constructor that requires the membership matrix.
+          */
+         explicit difference_evaluator_t(const membership_matrix_t& matrix)
+            :m_matrix { matrix },
+             m_intersections(matrix.words_per_row()),
+             m_unions(matrix.words_per_row())
+         {}
+         /*! Evaluates set difference with ID e, where e < 2^64, and returns the
+             id of the isolated feature, or no value if the set difference is empty.
+             Throws if the set difference contains more than one feature.
+          */
+         std::optional<std::size_t> operator()(maxnat_t e)
          {
-            differences_t result { };
-            for (maxnat_t e { 1 }; e < D(); ++e)
+            using word_t = membership_matrix_t::word_t;
+            const std::size_t n { m_matrix.words_per_row() };
+            word_t* intersections { m_intersections.data() };
+            word_t* unions { m_unions.data() };
+            std::fill(m_intersections.begin(),m_intersections.end(),~word_t { 0 });
+            std::fill(m_unions.begin(),m_unions.end(),word_t { 0 });
+            for (std::size_t s { 0 }; s < m_matrix.rows(); ++s)
             {
-               const auto& diff { generate_difference(e) };
-               const auto& res { evaluate_difference(diff) };
-               if (res.size() > 0)
+               const word_t* r { m_matrix.row(s).data() };
+               if (e >> s & 1llu)
                {
-                  if (res.size() != 1)
+                  for (std::size_t i { 0 }; i < n; ++i)
                   {
-                     throw std::length_error("Set size = " + std::to_string(res.size()) +  ", must be 1!");
+                     intersections[i] &= r[i];
+                  }
+               }
+               else
+               {
+                  for (std::size_t i { 0 }; i < n; ++i)
+                  {
+                     unions[i] |= r[i];
                   }
-                  result.push_back(system_feature_difference_t { e,*res.begin(),diff });
                }
             }
-            return result;
-         }
-         /*! Returns collection with non-empty set differences.
-          */
-         differences_t non_empty_differences() const
-         {
-            return m_non_empty_differences;
-         }
-         /*! Prints results of evaluating all set differences.
-             Takes output stream as parameter with std::cout as default value.
-          */
-         void print_results(std::ostream& os = std::cout) const
-         {
-            for (const auto& e : non_empty_differences())
+            std::size_t count { 0 },
+                        feature { 0 };
+            for (std::size_t i { 0 }; i < n; ++i)
+            {
+               if (const word_t w { intersections[i] & ~unions[i] }; w != 0)
+               {
+                  count += std::popcount(w);
+                  feature = i * bitset_t::word_bits + std::countr_zero(w);
+               }
+            }
+            if (count == 0)
+            {
+               return std::nullopt;
+            }
+            if (count != 1)
             {
-               os << difference_name(e.difference_id) << separator
-                  << e.feature << separator;
-               print_intersections(e.difference.intersections,os);
-               os << set_separator << set_difference << set_separator;
-               print_unions(e.difference.unions,os);
-               os << std::endl;
+               throw std::length_error("Set size = " + std::to_string(count) +  ", must be 1!");
             }
+            return feature;
          }
       private:
-         differences_t m_non_empty_differences;
+         const membership_matrix_t& m_matrix;
+         std::vector<membership_matrix_t::word_t> m_intersections,
+                                                  m_unions;
    };
 
-   /*! Class that performs feature location analysis
-       by calculating only valid set differences. In this approach,
-       only IDs for valid set differences are created.
+   /*! Options for enumerating all set differences in feature_location_differences_t.
     */
-   class feature_location_calculation_t: public feature_location_t
+   struct enumeration_options_t
+   {
+      /*! Number of threads that evaluate set differences.
+       */
+      unsigned threads { 1 };
+      /*! Number of set differences that are evaluated as a unit, or 0 to
+          split the set differences into at least min_chunks chunks of at most
+          2^20 set differences. The size does not depend on threads, so that a
+          checkpoint file can be resumed with any number of threads.
+       */
+      maxnat_t chunk_size { 0 };
+      /*! Number of chunks into which the set differences are split at least,
+          if chunk_size is 0 and there are enough set differences.
+       */
+      static constexpr maxnat_t min_chunks { 64 };
+      /*! Name of checkpoint file, or empty if no checkpoint file is to be used.
+          If the file exists, the enumeration resumes after the last chunk
+          recorded in it. Otherwise, it is created.
+       */
+      std::string checkpoint_file { };
+   };
+
+   /*! Size of a block of an async_streambuf_t in bytes.
+    */
+   constexpr maxnat_t async_block_size { 1llu << 20 };
+
+   /*! Number of blocks of an async_streambuf_t.
+    */
+   constexpr maxnat_t async_blocks { 4 };
+
+   /*! Stream buffer that passes its output block by block to a writer thread,
+       which writes the blocks to a target stream buffer, for example of a file,
+       a pipe, or std::cout. Thus, calculating the output and writing it overlap.
+       The blocks are exchanged through a bounded ring with a single producer
+       and a single consumer that uses atomic counters instead of locks.
+       If all blocks are in flight, the producer waits until the writer has
+       written one, so the required memory is bounded by the number of blocks
+       times their size.
+    */
+   class async_streambuf_t : public std::streambuf
    {
       public:
-         /*! Constructor that requires the number of idependent features
-             and the number of the model as parameters.
+         /*! Constructor that requires the target stream buffer, and optionally
+             the size of a block in bytes and the number of blocks, at least 2.
           */
-         feature_location_calculation_t(feature_id_t n_,
-                                        feature_id_t m_)
-              :feature_location_t(n_,m_),
-               m_systems_bitmask { initialize_bitmask() }
-         { 
-            m_independent_features = calculate_independent_features();
-            m_or_features = calculate_or_features();
-            m_and_features = calculate_and_features();
-            m_not_features = calculate_not_features();
-            m_or_not_features = calculate_or_not_features();
-            m_and_not_features = calculate_and_not_features();
-            concat(concat(concat(concat(concat(concat(m_all_features,
-                   m_independent_features),m_or_features),m_and_features),
-                   m_not_features),m_or_not_features),m_and_not_features
-                  );
-            m_differences = calculate_differences();
+         explicit async_streambuf_t(std::streambuf* target,maxnat_t block_size = async_block_size,
+                                    maxnat_t blocks = async_blocks)
+            :m_target { target },
+             m_blocks(std::max<maxnat_t>(blocks,2),std::string(std::max<maxnat_t>(block_size,1),'\0')),
+             m_sizes(m_blocks.size()),
+             m_writer { [this] { run(); } }
+         {
+            expose(0);
          }
-         /*! Calculates and returns bit mask that masks
-             non-existant systems.
+         async_streambuf_t(const async_streambuf_t&) = delete;
+         async_streambuf_t& operator=(const async_streambuf_t&) = delete;
+         /*! Writes the remaining output and stops the writer thread.
+          */
+         ~async_streambuf_t()
+         {
+            finish();
+         }
+         /*! Writes the remaining output, stops the writer thread, and flushes
+             the target. Afterwards, further output fails. Returns true if all
+             output has been written.
           */
-         maxnat_t initialize_bitmask() const
+         bool finish()
          {
-            maxnat_t bitmask {};
-            for (maxnat_t s {}; s < S(); ++s)
+            if (!m_writer.joinable())
             {
-              bitmask |= (1llu << s);
+               return !m_failed;
             }
-            return ~bitmask; 
+            submit();
+            const maxnat_t tail { m_tail.load(std::memory_order_relaxed) };
+            m_sizes[tail % m_blocks.size()] = end_of_output;
+            m_tail.store(tail + 1,std::memory_order_release);
+            m_tail.notify_one();
+            m_writer.join();
+            setp(nullptr,nullptr);
+            if (m_target->pubsync() == -1)
+            {
+               m_failed = true;
+            }
+            return !m_failed;
          }
-         /*! Returns bit mask that masks non-existant systems.
+      protected:
+         /*! Submits the current block and continues with the next free block.
           */
-         const maxnat_t& systems_bitmask() const
+         int_type overflow(int_type c) override
          {
-            return m_systems_bitmask;
+            if (pbase() == nullptr || !submit())
+            {
+               return traits_type::eof();
+            }
+            if (!traits_type::eq_int_type(c,traits_type::eof()))
+            {
+               *pptr() = traits_type::to_char_type(c);
+               pbump(1);
+            }
+            return traits_type::not_eof(c);
          }
-         /*! Calculates and returns set difference.
-             Takes system ID and system name as parameters.
+         /*! Submits the current block and waits until all blocks have been written.
           */
-         system_feature_difference_t calculate_difference(maxnat_t index,const std::string& name) const
+         int sync() override
          {
-            system_feature_difference_t result { index,name };
-            for (maxnat_t s { 0llu }; s < S(); ++s)
+            if (pbase() == nullptr || !submit())
             {
-               if (index & (1llu << s))
-               {
-                  result.difference.intersections.insert(system_name(s + 1));
-               }
-               else
-               {
-                  result.difference.unions.insert(system_name(s + 1));
-               }
+               return -1;
             }
-            return result;
+            const maxnat_t tail { m_tail.load(std::memory_order_relaxed) };
+            for (maxnat_t head { m_head.load(std::memory_order_acquire) }; head != tail;
+                 head = m_head.load(std::memory_order_acquire))
+            {
+               m_head.wait(head,std::memory_order_acquire);
+            }
+            return m_failed || m_target->pubsync() == -1 ? -1 : 0;
          }
-         /*! Evaluates and returns collection with all valid system differences.
+         /*! Returns the number of bytes that have been output, so that tellp() works.
+             Other positions are not supported.
           */
-         differences_t calculate_differences() const
+         pos_type seekoff(off_type off,std::ios_base::seekdir dir,std::ios_base::openmode which) override
          {
-            differences_t result;
-            for (const auto& [name,value]  : all_features())
+            if (off != 0 || dir != std::ios_base::cur || !(which & std::ios_base::out))
             {
-               result.push_back(calculate_difference(value,name));
+               return pos_type(off_type(-1));
             }
-            sort(result.begin(),result.end(),[] (auto a,auto b) -> bool { return a.difference_id < b.difference_id; });
-            return result;
+            return pos_type(static_cast<off_type>(m_submitted + (pptr() - pbase())));
          }
-         /*! Returns collection with valid system differences.
+      private:
+         /*! Size that marks the end of the output.
           */
-         differences_t differences() const
+         static constexpr maxnat_t end_of_output { ~maxnat_t { 0 } };
+         /*! Makes block t modulo the number of blocks the current block.
+          */
+         void expose(maxnat_t t)
          {
-            return m_differences;
+            char* p { m_blocks[t % m_blocks.size()].data() };
+            setp(p,p + m_blocks[t % m_blocks.size()].size());
          }
-         /*! Calculates and returns collection of independent features.
+         /*! Passes the current block to the writer thread, unless it is empty, and
+             waits until the next block is free. Returns false if the writer thread
+             failed to write a block.
           */
-         feature_expression_t calculate_independent_features() const
+         bool submit()
          {
-            feature_expression_t result;
-            for (maxnat_t f { 0 }; f < n(); ++f)
+            const maxnat_t size { static_cast<maxnat_t>(pptr() - pbase()) };
+            if (size == 0)
             {
-               maxnat_t value { 0 };
-               maxnat_t bit { 1 };
-               maxnat_t counter { power2(f) };
-               for (maxnat_t s { 0 }; s < power2(n()) - 1; ++s)
-               {
-                  value |= bit;
-                  --counter;
-                  value <<= 1llu;
-                  if (counter == 0llu)
-                  {
-                     bit = (bit == 1llu ? 0llu : 1llu);
-                     counter = power2(f);
-                  }
-               }
-               result.push_back(make_pair(independent_feature_name(f + 1),value));
+               return !m_failed;
             }
-            return result;
-         }
-         /*! Calculates and returns collection of or-features.
-          */
-         feature_expression_t calculate_or_features() const
-         {
-            feature_expression_t result;
-            if (hasO(M()))
+            const maxnat_t tail { m_tail.load(std::memory_order_relaxed) + 1 };
+            m_sizes[(tail - 1) % m_blocks.size()] = size;
+            m_submitted += size;
+            m_tail.store(tail,std::memory_order_release);
+            m_tail.notify_one();
+            for (maxnat_t head { m_head.load(std::memory_order_acquire) }; tail - head >= m_blocks.size();
+                 head = m_head.load(std::memory_order_acquire))
             {
-               for (feature_id_t k { 2 }; k <= n(); ++k)
-               {
-                  combination_t combination { raw_independent_features(),k };
-                  do 
-                  {
-                     result.push_back( { or_feature_name(combination()), or_feature_value(combination(),independent_features()) } );
-                  } while (combination.next());
-               }
+               m_head.wait(head,std::memory_order_acquire);
             }
-            return result;
+            expose(tail);
+            return !m_failed;
          }
-         /*! Calculates and returns collection of and-features.
+         /*! Writes the submitted blocks in their order until the end of the output.
+             After a failure, the remaining blocks are discarded.
           */
-         feature_expression_t calculate_and_features() const
+         void run()
          {
-            feature_expression_t result;
-            if (hasA(M()))
+            for (maxnat_t head { 0 }; ; )
             {
-               for (feature_id_t k { 2 }; k <= n(); ++k)
+               for (maxnat_t tail { m_tail.load(std::memory_order_acquire) }; tail == head;
+                    tail = m_tail.load(std::memory_order_acquire))
                {
-                  combination_t combination { raw_independent_features(),k };
-                  do 
-                  {
-                     result.push_back( { and_feature_name(combination()), and_feature_value(combination(),independent_features()) } );
-                  } while (combination.next());
+                  m_tail.wait(tail,std::memory_order_acquire);
+               }
+               const maxnat_t size { m_sizes[head % m_blocks.size()] };
+               if (size == end_of_output)
+               {
+                  return;
                }
+               if (!m_failed && m_target->sputn(m_blocks[head % m_blocks.size()].data(),size) !=
+                                static_cast<std::streamsize>(size))
+               {
+                  m_failed = true;
+               }
+               m_head.store(++head,std::memory_order_release);
+               m_head.notify_one();
             }
-            return result;
          }
-         /*! Calculates and returns collection of not-features.
+         std::streambuf*          m_target;
+         std::vector<std::string> m_blocks;
+         std::vector<maxnat_t>    m_sizes;
+         maxnat_t                 m_submitted { 0 };
+         std::atomic<maxnat_t>    m_head { 0 },
+                                  m_tail { 0 };
+         std::atomic<bool>        m_failed { false };
+         std::thread              m_writer;
+   };
+
+   /*! Output file stream whose output is written by a writer thread,
+       see async_streambuf_t. It can be used instead of std::ofstream.
+    */
+   class async_ofstream_t : public std::ostream
+   {
+      public:
+         /*! Constructor that requires the name of the file, which is created or truncated.
           */
-         feature_expression_t calculate_not_features() const
+         explicit async_ofstream_t(const std::string& file_name)
+            :std::ostream { nullptr },
+             m_async { open(m_file,file_name) }
          {
-            feature_expression_t result;
-            if (hasN(M()))
+            init(&m_async);
+            if (!m_file.is_open())
             {
-               for (const auto& f : independent_features())
-               {
-                  // Possible source of errors: The following line does not call
-                  // not_feature_name()! Instead it uses feature_not + f.first!
-                  result.push_back(make_pair(feature_not + f.first,~(f.second ^ systems_bitmask())));
-               }
+               setstate(std::ios::failbit);
             }
-            return result;
          }
-         /*! Calculates and returns collection of or-not-features.
+         /*! Writes the remaining output and closes the file.
+             Sets failbit if not all output could be written.
           */
-         feature_expression_t calculate_or_not_features() const
+         void close()
          {
-            feature_expression_t result;
-            if (hasON(M()))
+            if (!m_async.finish() || !m_file.close())
             {
-               for (feature_id_t k { 2 }; k <= n(); ++k)
-               {
-                  combination_t combination { raw_independent_features(),k };
-                  do 
-                  {
-                     result.push_back( { or_not_feature_name(combination()), or_not_feature_value(combination(),not_features()) } );
-                  } while (combination.next());
-               }
+               setstate(std::ios::failbit);
             }
-            return result;
          }
-         /*! Calculates and returns collection of and-not-features.
+      private:
+         /*! Opens file for output and returns a pointer to it.
           */
-         feature_expression_t calculate_and_not_features() const
+         static std::filebuf* open(std::filebuf& file,const std::string& file_name)
          {
-            feature_expression_t result;
-            if (hasAN(M()))
-            {
-               for (feature_id_t k { 2 }; k <= n(); ++k)
+            file.open(file_name,std::ios::out | std::ios::trunc);
+            return &file;
+         }
+         std::filebuf      m_file;
+         async_streambuf_t m_async;
+   };
+
+   /*! instrumenting turns the measurement of phases on or off.
+       Like checking in fl.cpp, instrumenting should always be tested
+       with if constexpr. Then, the measurement is not included in the
+       object code if instrumenting is initialized to false.
+    */
+   constexpr bool instrumenting { false }; // Initialize to true
+                                           // to turn on instrumentation.
+
+   /*! Records wall time, CPU time, and counters of the phases of an analysis,
+       and reports them together with the peak resident set size as JSON.
+       The counters are added to the phase that is currently open.
+    */
+   class instrumentation_t
+   {
+      public:
+         /*! Measurements of a single phase.
+          */
+         struct phase_t
+         {
+            /*! Name of the phase.
+             */
+            std::string name;
+            /*! Elapsed wall time and CPU time of the process in seconds.
+             */
+            double wall_seconds { 0 },
+                   cpu_seconds { 0 };
+            /*! Number of combinations enumerated, bitstring operations performed,
+                and lines and bytes written.
+             */
+            maxnat_t combinations { 0 },
+                     operations { 0 },
+                     lines { 0 },
+                     bytes { 0 };
+         };
+         /*! Opens a phase on construction and closes it on destruction.
+             Phases may be nested, counters are added to the innermost open phase.
+          */
+         class scope_t
+         {
+            public:
+               scope_t(instrumentation_t& owner,const char* name)
+                  :m_owner { owner }
                {
-                  combination_t combination { raw_independent_features(),k };
-                  do 
+                  if constexpr (instrumenting)
                   {
-                     result.push_back( { and_not_feature_name(combination()), and_not_feature_value(combination(),not_features(),systems_bitmask()) } );
-                  } while (combination.next());
+                     m_index = m_owner.begin(name);
+                     m_wall_start = std::chrono::steady_clock::now();
+                     m_cpu_start = std::clock();
+                  }
+               }
+               scope_t(const scope_t&) = delete;
+               scope_t& operator=(const scope_t&) = delete;
+               ~scope_t()
+               {
+                  if constexpr (instrumenting)
+                  {
+                     m_owner.end(m_index,
+                                 std::chrono::duration<double>(std::chrono::steady_clock::now() - m_wall_start).count(),
+                                 static_cast<double>(std::clock() - m_cpu_start) / CLOCKS_PER_SEC);
+                  }
+               }
+            private:
+               instrumentation_t& m_owner;
+               std::size_t m_index { 0 };
+               std::chrono::steady_clock::time_point m_wall_start { };
+               std::clock_t m_cpu_start { };
+         };
+         /*! Opens a phase with the given name, which is closed when the
+             returned object is destroyed.
+          */
+         scope_t phase(const char* name)
+         {
+            return scope_t(*this,name);
+         }
+         /*! Adds to the counters of the innermost open phase.
+          */
+         void add(maxnat_t combinations,maxnat_t operations = 0,maxnat_t lines = 0,maxnat_t bytes = 0)
+         {
+            if constexpr (instrumenting)
+            {
+               if (!m_open.empty())
+               {
+                  auto& p { m_phases[m_open.back()] };
+                  p.combinations += combinations;
+                  p.operations += operations;
+                  p.lines += lines;
+                  p.bytes += bytes;
                }
             }
-            return result;
          }
-         /*! Returns collection with all independent feature names plus difference ID plus set difference.
+         /*! Returns all phases in the order in which they were opened.
           */
-         feature_expression_t independent_features() const
+         const std::vector<phase_t>& phases() const
          {
-            return m_independent_features;
+            return m_phases;
          }
-         /*! Returns collection with all or-feature names plus difference ID plus set difference.
+         /*! Returns the peak resident set size of the process in bytes,
+             or 0 if it is not available.
           */
-         feature_expression_t or_features() const
+         static maxnat_t peak_rss()
          {
-            return m_or_features;
+#if defined(__unix__) || defined(__APPLE__)
+            rusage usage { };
+            if (getrusage(RUSAGE_SELF,&usage) == 0)
+            {
+#if defined(__APPLE__)
+               return usage.ru_maxrss;
+#else
+               return static_cast<maxnat_t>(usage.ru_maxrss) * 1024;
+#endif
+            }
+#endif
+            return 0;
          }
-         /*! Returns collection with all and-feature names plus difference ID plus set difference.
+         /*! Prints the report as JSON.
+             Takes output stream, the name of the program, F, and M as parameters.
           */
-         feature_expression_t and_features() const
+         void print_json(std::ostream& os,const std::string& program,maxnat_t F,maxnat_t M) const
          {
-            return m_and_features;
+            os << "{\n  \"program\": \"" << program << "\",\n  \"F\": " << F
+               << ",\n  \"M\": " << M << ",\n  \"phases\": [";
+            for (std::size_t i { 0 }; i < m_phases.size(); ++i)
+            {
+               const auto& p { m_phases[i] };
+               os << (i ? "," : "") << "\n    { \"name\": \"" << p.name
+                  << "\", \"wall_seconds\": " << p.wall_seconds
+                  << ", \"cpu_seconds\": " << p.cpu_seconds
+                  << ", \"combinations\": " << p.combinations
+                  << ", \"operations\": " << p.operations
+                  << ", \"lines\": " << p.lines
+                  << ", \"bytes\": " << p.bytes << " }";
+            }
+            os << "\n  ],\n  \"peak_rss_bytes\": " << peak_rss() << "\n}\n";
          }
-         /*! Returns collection with all not-feature names plus difference ID plus set difference.
+      private:
+         std::size_t begin(const char* name)
+         {
+            m_phases.push_back(phase_t { name });
+            m_open.push_back(m_phases.size() - 1);
+            return m_phases.size() - 1;
+         }
+         void end(std::size_t index,double wall_seconds,double cpu_seconds)
+         {
+            m_phases[index].wall_seconds = wall_seconds;
+            m_phases[index].cpu_seconds = cpu_seconds;
+            m_open.pop_back();
+         }
+         std::vector<phase_t> m_phases;
+         std::vector<std::size_t> m_open;
+   };
+
+   /*! Base class for all classes that perform feature location.
+    */
+   class feature_location_t
+   {
+      public:
+         /*! Constructor that requires the number of idependent features
+             and the number of the model as parameters.
           */
-         feature_expression_t not_features() const
+         feature_location_t(feature_id_t n_,
+                            feature_id_t m_)
+              :m_n { n_ },
+               m_F { n_ },
+               m_M { m_ },
+               m_S { power2(n_) },
+               m_O { hasO(m_) ? sum_of_combinations(n_,2) : 0 },
+               m_A { hasA(m_) ? sum_of_combinations(n_,2) : 0 },
+               m_N { hasN(m_) ? n_ : 0u },
+               m_ON { hasON(m_) ? sum_of_combinations(n_,2) : 0 },
+               m_AN { hasAN(m_) ? sum_of_combinations(n_,2) : 0 },
+               m_I { (hasO(m_) ? sum_of_combinations(n_,2) : 0) +
+                     (hasA(m_) ? sum_of_combinations(n_,2) : 0) +
+                     (hasN(m_) ? n_ : 0) +
+                     (hasAN(m_) ? sum_of_combinations(n_,2) : 0) +
+                     (hasON(m_) ? sum_of_combinations(n_,2) : 0)
+                   },
+               m_T { n_ +
+                     (hasO(m_) ? sum_of_combinations(n_,2) : 0) +
+                     (hasA(m_) ? sum_of_combinations(n_,2) : 0) +
+                     (hasN(m_) ? n_ : 0) +
+                     (hasAN(m_) ? sum_of_combinations(n_,2) : 0) +
+                     (hasON(m_) ? sum_of_combinations(n_,2) : 0)
+                   },
+               m_D { exact_power2(power2(n_)) }
          {
-            return m_not_features;
+            if (n_ >= sizeof(maxnat_t) * CHAR_BIT)
+            {
+               throw std::overflow_error("The number of systems of " + std::to_string(n_) +
+                                         " independent features does not fit into maxnat_t.");
+            }
+            {
+               const auto phase { instrument().phase("raw_features") };
+               for (std::size_t i { 1 }; i <= m_n; ++i)
+               {
+                  m_raw_independent_features.push_back(i);
+               }
+               for (std::size_t i { 2 }; i <= m_n; ++i)
+               {
+                  combination_t c(raw_independent_features(),i);
+                  do
+                  {
+                     m_raw_dependent_features.push_back(c());
+                     m_raw_dependent_masks.push_back(vector2unsigned(c.symbols()));
+                     instrument().add(1);
+                  } while (c.next());
+               }
+            }
+            const auto phase { instrument().phase("intern_features") };
+            intern_features();
          }
-         /*! Returns collection with all or-not-feature names plus difference ID plus set difference.
+         /*! Returns the number of independent features, same as F().
           */
-         feature_expression_t or_not_features() const
+         const auto& n() const
          {
-            return m_or_not_features;
+            return m_n;
          }
-         /*! Returns collection with all and-not-feature names plus difference ID plus set difference.
+         /*! Returns the number of independent features, same as n().
+         */
+         const auto& F() const
+         {
+            return m_F;
+         }
+         /*! Returns the number of systems of SPL.
+         */
+         const auto& S() const
+         {
+            return m_S;
+         }
+         /*! Returns the number of selected model.
+         */
+         const auto& M() const
+         {
+            return m_M;
+         }
+         /*! Returns the actual number of or-features.
+         */
+         const auto& O() const
+         {
+            return m_O;
+         }
+         /*! Returns the actual number of and-features.
+         */
+         const auto& A() const
+         {
+            return m_A;
+         }
+         /*! Returns the actual number of not-features.
+         */
+         const auto& N() const
+         {
+            return m_N;
+         }
+         /*! Returns actual number of or-not-features.
+         */
+         const auto& ON() const
+         {
+            return m_ON;
+         }
+         /*! Returns actual number of and-not-features.
+         */
+         const auto& AN() const
+         {
+            return m_AN;
+         }
+         /*! Returns the actual number of inherently dependent features.
+         */
+         const auto& DF() const
+         {
+            return m_I;
+         }
+         /*! Returns the actual total number of features.
+         */
+         const auto& T() const
+         {
+            return m_T;
+         }
+         /*! Returns the number of all possible set differences of SPL systems.
+             Throws std::overflow_error if it does not fit into maxnat_t, that is for F > 5.
+         */
+         maxnat_t D() const
+         {
+            return m_D.to_maxnat();
+         }
+         /*! Returns the number of all possible set differences of SPL systems as exact_count_t,
+             which has overflowed for F > 6.
+         */
+         const exact_count_t& exact_D() const
+         {
+            return m_D;
+         }
+         /*! Returns the number of all possible set differences of SPL systems
+             as decimal number, or as power of 2 if it does not fit into exact_count_t.
+         */
+         std::string difference_count() const
+         {
+            return m_D.overflow() ? "2^" + std::to_string(S()) : m_D.to_string();
+         }
+         /*! Creates and returns a collection with the IDs of all independent features.
+             Takes raw feature IDs for single system.
           */
-         feature_expression_t and_not_features() const
+         feature_indices_t generate_independent_features(const std::vector<feature_id_t>& f) const
          {
-            return m_and_not_features;
+            feature_indices_t result;
+            for (const auto& i : f)
+            {
+               result.push_back(m_independent_ids.at(i - 1));
+            }
+            return result;
          }
-         /*! Returns collection with all feature names plus difference ID plus set difference.
+         /*! Creates and returns a collection with the IDs of all or-features.
+             Takes raw feature IDs for single system.
           */
-         feature_expression_t all_features() const
+         feature_indices_t generate_or_features(const std::vector<feature_id_t>& f) const
          {
-            return m_all_features;
+            feature_indices_t result;
+            if (hasO(M()))
+            {
+               const maxnat_t mask { vector2unsigned(f) };
+               for (std::size_t j { 0 }; j < m_raw_dependent_masks.size(); ++j)
+               {
+                  if (m_raw_dependent_masks[j] & mask)
+                  {
+                     result.push_back(m_or_ids[j]);
+                  }
+               }
+               sort(result.begin(),result.end());
+            }
+            return result;
          }
-         /*! Prints intersection part, that is the left operand, of set difference.
-             Takes output stream as parameter with std::cout as default value.
+         /*! Creates and returns a collection with the IDs of all and-features.
+             Takes raw feature IDs for single system.
           */
-         void print_intersections(const std::set<std::string>& s,std::ostream& os = std::cout) const
+         feature_indices_t generate_and_features(const std::vector<feature_id_t>& f) const
          {
-           std::size_t counter { },
-                       size { s.size() };
-            os << opening_parenthesis << set_separator;
-            for (const auto& e : s)
+            feature_indices_t result;
+            if (hasA(M()))
             {
-               os << e;
-               if (++counter < size)
+               const maxnat_t mask { vector2unsigned(f) };
+               for (std::size_t j { 0 }; j < m_raw_dependent_masks.size(); ++j)
                {
-                  os << set_separator << set_intersection << set_separator;
+                  if ((m_raw_dependent_masks[j] & ~mask) == 0)
+                  {
+                     result.push_back(m_and_ids[j]);
+                  }
                }
+               sort(result.begin(),result.end());
             }
-            os << set_separator << closing_parenthesis;
+            return result;
          }
-         /*! Prints union part, that is the right operand, of set difference.
-             Takes output stream as parameter with std::cout as default value.
+         /*! Creates and returns a collection with the IDs of all not-features.
+             Takes raw feature IDs for single system.
           */
-         void print_unions(const std::set<std::string>& s,std::ostream& os = std::cout) const
+         feature_indices_t generate_not_features(const std::vector<feature_id_t>& nf) const
          {
-            std::size_t counter { },
-                        size { s.size() };
-            os << opening_parenthesis << set_separator;
-            for (const auto& e : s)
+            feature_indices_t result;
+            if (hasN(M()))
             {
-               os << e;
-               if (++counter < size)
+               for (const auto& i : negate(nf,n()))
                {
-                  os << set_separator << set_union << set_separator;
+                  result.push_back(m_not_ids.at(i - 1));
                }
             }
-            os << set_separator << closing_parenthesis;
+            return result;
          }
-         /*! Prints results of feature isolation.
-             Takes output stream as parameter with std::cout as default value.
+         /*! Creates and returns a collection with the IDs of all or-not-features.
+             Takes raw feature IDs for single system.
           */
-         void print_results(std::ostream& os = std::cout) const
+         feature_indices_t generate_or_not_features(const std::vector<feature_id_t>& nf) const
          {
-            for (const auto& e : differences())
+            feature_indices_t result;
+            if (hasON(M()))
             {
-               os << difference_name(e.difference_id) << separator
-                  << e.feature << separator;
-               print_intersections(e.difference.intersections,os);
-               os << set_separator << set_difference << set_separator;
-               print_unions(e.difference.unions,os);
-               os << std::endl;
+               const maxnat_t mask { vector2unsigned(negate(nf,n())) };
+               for (std::size_t j { 0 }; j < m_raw_dependent_masks.size(); ++j)
+               {
+                  if (m_raw_dependent_masks[j] & mask)
+                  {
+                     result.push_back(m_or_not_ids[j]);
+                  }
+               }
+               sort(result.begin(),result.end());
             }
+            return result;
          }
-      private:
-         const maxnat_t m_systems_bitmask;
-         differences_t m_differences;
-         feature_expression_t m_independent_features,
-                              m_or_features,
-                              m_and_features,
-                              m_not_features,
-                              m_or_not_features,
-                              m_and_not_features,
-                              m_all_features;
-   };
+         /*! Creates and returns a collection with the IDs of all and-not-features.
+             Takes raw feature IDs for single system.
+          */
+         feature_indices_t generate_and_not_features(const std::vector<feature_id_t>& nf) const
+         {
+            feature_indices_t result;
+            if (hasAN(M()))
+            {
+               const maxnat_t mask { vector2unsigned(negate(nf,n())) };
+               for (std::size_t j { 0 }; j < m_raw_dependent_masks.size(); ++j)
+               {
+                  if ((m_raw_dependent_masks[j] & ~mask) == 0)
+                  {
+                     result.push_back(m_and_not_ids[j]);
+                  }
+               }
+               sort(result.begin(),result.end());
+            }
+            return result;
+         }
+         /*! Creates and returns the sorted IDs of all features that define a system.
+             Takes raw feature IDs for single system.
+          */
+         system_t generate_system(const std::vector<feature_id_t>& f)  const
+         {
+            system_t result;
+            concat(result,generate_independent_features(f));
+            concat(result,generate_or_features(f));
+            concat(result,generate_and_features(f));
+            concat(result,generate_not_features(f));
+            concat(result,generate_or_not_features(f));
+            concat(result,generate_and_not_features(f));
+            sort(result.begin(),result.end());
+            return result;
+         }
+         /*! Creates and returns the sorted IDs of all features that define
+             system s + 1, where s is in the range [0,S).
+          */
+         system_t system_at(maxnat_t s) const
+         {
+            return generate_system(unsigned2vector(s));
+         }
+         /*! Read-only view of all systems of the SPL. A system is created
+             by system_at() when it is accessed, and it is not stored.
+          */
+         class systems_view_t
+         {
+            public:
+               /*! Input iterator that creates the systems in ascending order.
+                */
+               class iterator
+               {
+                  public:
+                     using iterator_category = std::input_iterator_tag;
+                     using value_type        = system_t;
+                     using difference_type   = std::ptrdiff_t;
+                     using pointer           = void;
+                     using reference         = system_t;
+                     /*! Default constructor required by input iterators.
+                      */
+                     iterator() = default;
+                     /*! Constructor that requires the analysis and the
+                         index of the current system.
+                      */
+                     iterator(const feature_location_t* spl,maxnat_t s)
+                        :m_spl { spl },
+                         m_s { s }
+                     {}
+                     system_t operator*() const
+                     {
+                        return m_spl->system_at(m_s);
+                     }
+                     iterator& operator++()
+                     {
+                        ++m_s;
+                        return *this;
+                     }
+                     iterator operator++(int)
+                     {
+                        auto result { *this };
+                        ++m_s;
+                        return result;
+                     }
+                     bool operator==(const iterator& right) const
+                     {
+                        return m_s == right.m_s;
+                     }
+                  private:
+                     const feature_location_t* m_spl { nullptr };
+                     maxnat_t m_s { 0 };
+               };
+               /*! Constructor that requires the analysis whose systems are viewed.
+                */
+               explicit systems_view_t(const feature_location_t& spl)
+                  :m_spl { &spl }
+               {}
+               iterator begin() const
+               {
+                  return iterator { m_spl,0 };
+               }
+               iterator end() const
+               {
+                  return iterator { m_spl,m_spl->S() };
+               }
+               /*! Returns the number of systems.
+                */
+               maxnat_t size() const
+               {
+                  return m_spl->S();
+               }
+               /*! Creates and returns system s + 1.
+                */
+               system_t operator[](maxnat_t s) const
+               {
+                  return m_spl->system_at(s);
+               }
+            private:
+               const feature_location_t* m_spl;
+         };
+         /*! Returns a view of all systems of the SPL.
+          */
+         systems_view_t systems() const
+         {
+            return systems_view_t { *this };
+         }
+         /*! Creates and returns a collection of all systems of the SPL.
+          */
+         systems_t generate_all_systems() const 
+         {
+            systems_t result;
+            result.reserve(S());
+            for (auto&& system : systems())
+            {
+               result.push_back(std::move(system));
+            }
+            return result;
+         }
+         /*! Returns the table with the names of all features of the model.
+          */
+         const feature_table_t& feature_table() const
+         {
+            return m_feature_table;
+         }
+         /*! Returns the name of the feature with ID i.
+          */
+         const std::string& feature_name(feature_index_t i) const
+         {
+            return m_feature_table.name(i);
+         }
+         /*! Returns the IDs of the independent features in the order of
+             raw_independent_features().
+          */
+         const feature_indices_t& independent_ids() const
+         {
+            return m_independent_ids;
+         }
+         /*! Returns the IDs of the or-features in the order of raw_dependent_features(),
+             or an empty collection if the model has no or-features.
+          */
+         const feature_indices_t& or_ids() const
+         {
+            return m_or_ids;
+         }
+         /*! Returns the IDs of the and-features in the order of raw_dependent_features(),
+             or an empty collection if the model has no and-features.
+          */
+         const feature_indices_t& and_ids() const
+         {
+            return m_and_ids;
+         }
+         /*! Returns the IDs of the not-features in the order of raw_independent_features(),
+             or an empty collection if the model has no not-features.
+          */
+         const feature_indices_t& not_ids() const
+         {
+            return m_not_ids;
+         }
+         /*! Returns the IDs of the or-not-features in the order of raw_dependent_features(),
+             or an empty collection if the model has no or-not-features.
+          */
+         const feature_indices_t& or_not_ids() const
+         {
+            return m_or_not_ids;
+         }
+         /*! Returns the IDs of the and-not-features in the order of raw_dependent_features(),
+             or an empty collection if the model has no and-not-features.
+          */
+         const feature_indices_t& and_not_ids() const
+         {
+            return m_and_not_ids;
+         }
+         /*! Returns a collection with raw independent feature IDs. 
+          */
+         const std::vector<feature_id_t>& raw_independent_features() const
+         {
+            return m_raw_independent_features;
+         }
+         /*! Returns a collection with collection of raw feature IDs that
+             represents dependent features (with the exception of not-features).
+          */
+         const std::vector<std::vector<feature_id_t>>& raw_dependent_features() const
+         {
+            return m_raw_dependent_features;
+         }
+         /*! Returns the measurements of the phases of the analysis,
+             which are only recorded if instrumenting is true.
+          */
+         const instrumentation_t& instrumentation() const
+         {
+            return m_instrumentation;
+         }
+         /*! Prints the measurements of the phases of the analysis as JSON.
+             Takes output stream and name of the program as parameters.
+          */
+         void print_report(std::ostream& os,const std::string& program) const
+         {
+            m_instrumentation.print_json(os,program,F(),M());
+         }
+         /*! Prints header for results of feature location analysis.
+             Takes output stream as parameter with std::cout as default value.
+          */
+         void print_header(std::ostream& os = std::cout)
+         {
+            const auto phase { instrument().phase("print_header") };
+            const auto start { stream_position(os) };
+            instrument().add(0,0,11);
+            os << "M" << M() << separator << "selected model\n"
+               << T() << separator << "T" << separator << "actual total number of features\n"
+               << F() << separator << "F" << separator << "number of independent features\n"
+               << DF() << separator << "DF" << separator << "actual total number of inherently dependent features\n"
+               << O() << separator << "O" << separator << "actual number of or-features\n"
+               << A() << separator << "A" << separator << "actual number of and-features\n"
+               << N() << separator << "N" << separator << "actual number of not-features\n"
+               << ON() << separator << "ON" << separator << "actual number of or-not-features\n"
+               << AN() << separator << "AN" << separator << "actual number of and-not-features\n"
+               << S() << separator << "S" << separator << "number of systems of SPL\n"
+               << difference_count() << separator << "D" << separator << "number of all set differences of SPL systems\n";
+            count_bytes(os,start);
+         }
+
+         /*! Creates and returns the set difference that intersects
+             all systems whose bit is set in intersected and unites
+             all other systems.
+          */
+         systems_difference_t make_difference(const bitset_t& intersected) const
+         {
+            return systems_difference_t { intersected };
+         }
+         /*! Prints intersection part, that is the left operand, of set difference.
+             Takes the systems to be intersected and output stream as parameters
+             with std::cout as default value.
+          */
+         void print_intersections(const bitset_t& s,std::ostream& os = std::cout) const
+         {
+            print_operand(s,false,set_intersection,os);
+         }
+         /*! Prints union part, that is the right operand, of set difference.
+             Takes the systems to be united and output stream as parameters
+             with std::cout as default value.
+          */
+         void print_unions(const bitset_t& s,std::ostream& os = std::cout) const
+         {
+            print_operand(s,false,set_union,os);
+         }
+         /*! Prints a set difference, that is, its intersection part,
+             the difference operator, and its union part.
+             Takes output stream as parameter with std::cout as default value.
+          */
+         void print_difference(const systems_difference_t& d,std::ostream& os = std::cout) const
+         {
+            std::string line;
+            append_difference(line,d);
+            os.write(line.data(),line.size());
+         }
+         /*! Prints all systems with the features that define them.
+             Takes output stream as parameter with std::cout as default value.
+          */
+         void print_systems(std::ostream& os = std::cout)
+         {
+            const auto phase { instrument().phase("print_systems") };
+            const auto start { stream_position(os) };
+            std::string line;
+            for (maxnat_t i { 0 };const auto & system : systems())
+            {
+               line = features::system;
+               append_number(line,++i);
+               line += separator;
+               for (const auto feature : system)
+               {
+                  line += feature_name(feature);
+                  line += separator;
+               }
+               line += '\n';
+               os.write(line.data(),line.size());
+               instrument().add(0,0,1);
+            }
+            count_bytes(os,start);
+         }
+     protected:
+         /*! Returns the instrumentation, which may be updated by const member functions.
+          */
+         instrumentation_t& instrument() const
+         {
+            return m_instrumentation;
+         }
+         /*! Returns the current position of os if instrumenting is true
+             and the position is available, and -1 otherwise.
+          */
+         static std::ostream::pos_type stream_position(std::ostream& os)
+         {
+            if constexpr (instrumenting)
+            {
+               return os.tellp();
+            }
+            return std::ostream::pos_type(-1);
+         }
+         /*! Adds the number of bytes that have been written to os
+             since position start to the open phase.
+          */
+         void count_bytes(std::ostream& os,std::ostream::pos_type start) const
+         {
+            if constexpr (instrumenting)
+            {
+               if (const auto end { os.tellp() }; start != std::ostream::pos_type(-1) && end != std::ostream::pos_type(-1))
+               {
+                  instrument().add(0,0,0,static_cast<maxnat_t>(end - start));
+               }
+            }
+         }
+     protected:
+         /*! Appends the set difference d, that is, its intersection part,
+             the difference operator, and its union part, to line.
+          */
+         void append_difference(std::string& line,const systems_difference_t& d) const
+         {
+            append_operand(line,d.intersections,false,set_intersection);
+            line += set_separator;
+            line += set_difference;
+            line += set_separator;
+            append_operand(line,d.intersections,true,set_union);
+         }
+     private:
+         /*! Prints the names of all systems whose bit in s differs from negated,
+             in the order of their names, separated by operation op.
+          */
+         void print_operand(const bitset_t& s,bool negated,const std::string& op,std::ostream& os) const
+         {
+            std::string line;
+            append_operand(line,s,negated,op);
+            os.write(line.data(),line.size());
+         }
+         /*! Appends the names of all systems whose bit in s differs from negated
+             to line, in the order of their names, separated by operation op.
+          */
+         void append_operand(std::string& line,const bitset_t& s,bool negated,const std::string& op) const
+         {
+            const maxnat_t size { negated ? s.size() - s.count() : s.count() };
+            maxnat_t counter { };
+            line += opening_parenthesis;
+            line += set_separator;
+            for (maxnat_t i { S() > 0 ? 1u : 0u }; i != 0; i = next_lexicographic(i,S()))
+            {
+               if (s.test(i - 1) != negated)
+               {
+                  line += system;
+                  append_number(line,i);
+                  if (++counter < size)
+                  {
+                     line += set_separator;
+                     line += op;
+                     line += set_separator;
+                  }
+               }
+            }
+            line += set_separator;
+            line += closing_parenthesis;
+         }
+         /*! Builds the feature table of the model and records the ID of each feature.
+          */
+         void intern_features()
+         {
+            feature_names_t independent,
+                            ors,
+                            ands,
+                            nots,
+                            or_nots,
+                            and_nots;
+            for (const auto& i : raw_independent_features())
+            {
+               independent.push_back(independent_feature_name(i));
+               if (hasN(M()))
+               {
+                  nots.push_back(not_feature_name(i));
+               }
+            }
+            feature_name_buffer_t or_name { feature_or,false },
+                                  and_name { feature_and,false },
+                                  or_not_name { feature_or,true },
+                                  and_not_name { feature_and,true };
+            for (const auto& j : raw_dependent_features())
+            {
+               if (hasO(M()))
+               {
+                  ors.push_back(or_name(j));
+               }
+               if (hasA(M()))
+               {
+                  ands.push_back(and_name(j));
+               }
+               if (hasON(M()))
+               {
+                  or_nots.push_back(or_not_name(j));
+               }
+               if (hasAN(M()))
+               {
+                  and_nots.push_back(and_not_name(j));
+               }
+            }
+            feature_names_t all;
+            all.reserve(T());
+            concat(concat(concat(concat(concat(concat(all,independent),ors),ands),nots),or_nots),and_nots);
+            m_feature_table = feature_table_t { std::move(all) };
+            auto ids { [this] (const feature_names_t& names)
+                       {
+                          feature_indices_t result;
+                          result.reserve(names.size());
+                          for (const auto& name : names)
+                          {
+                             result.push_back(m_feature_table.id(name));
+                          }
+                          return result;
+                       }
+                     };
+            m_independent_ids = ids(independent);
+            m_or_ids = ids(ors);
+            m_and_ids = ids(ands);
+            m_not_ids = ids(nots);
+            m_or_not_ids = ids(or_nots);
+            m_and_not_ids = ids(and_nots);
+         }
+         const feature_id_t  m_n;
+         const maxnat_t m_F;
+         const feature_id_t m_M;
+
+         const maxnat_t m_S,
+                        m_O,
+                        m_A,
+                        m_N,
+                        m_ON,
+                        m_AN,
+                        m_I,
+                        m_T;
+         const exact_count_t m_D;
+         std::vector<feature_id_t> m_raw_independent_features;
+         std::vector<std::vector<feature_id_t>> m_raw_dependent_features;
+         std::vector<maxnat_t> m_raw_dependent_masks;
+         feature_table_t m_feature_table;
+         feature_indices_t m_independent_ids,
+                           m_or_ids,
+                           m_and_ids,
+                           m_not_ids,
+                           m_or_not_ids,
+                           m_and_not_ids;
+         mutable instrumentation_t m_instrumentation;
+   };
+
+   /*! Class that performs feature location analysis
+       based on feature isolation. In this approach,
+       no IDs for set differences are created.
+    */
+   class feature_location_isolation_t: public feature_location_t
+   {
+      public:
+         /*! Constructor that requires the number of independent features
+             and the number of the model as parameters.
+          */
+         feature_location_isolation_t(feature_id_t n_,
+                                      feature_id_t m_)
+              :feature_location_t(n_,m_)
+         { 
+            {
+               const auto phase { instrument().phase("generate_all_systems") };
+               m_all_systems = generate_all_systems();
+            }
+            {
+               const auto phase { instrument().phase("generate_features") };
+               m_independent_features = generate_independent_features();
+               m_or_features = generate_or_features();
+               m_and_features = generate_and_features();
+               m_not_features = generate_not_features();
+               m_or_not_features = generate_or_not_features();
+               m_and_not_features = generate_and_not_features();
+               m_all_features.reserve(m_all_features.size()
+                                      + m_independent_features.size()
+                                      + m_or_features.size()
+                                      + m_and_features.size()
+                                      + m_not_features.size()
+                                      + m_or_not_features.size()
+                                      + m_and_not_features.size()
+                                    );
+               concat(concat(concat(concat(concat(concat(m_all_features,
+                      m_independent_features),m_or_features),m_and_features),
+                      m_not_features),m_or_not_features),m_and_not_features
+                     );
+               std::sort(m_all_features.begin(),m_all_features.end());
+            }
+            m_feature_isolations = generate_feature_isolations();
+         }
+         /*! Creates and returns a collection with the IDs of all
+             independent features of all systems of the SPL.
+          */
+         feature_indices_t generate_independent_features() const
+         {
+            return independent_ids();
+         }
+         /*! Creates and returns a collection with the IDs of all
+             or-features of all systems of the SPL.
+          */
+         feature_indices_t generate_or_features() const
+         {
+            return or_ids();
+         }
+         /*! Creates and returns a collection with the IDs of all
+             and-features of all systems of the SPL.
+          */
+         feature_indices_t generate_and_features() const
+         {
+            return and_ids();
+         }
+         /*! Creates and returns a collection with the IDs of all
+             not-features of all systems of the SPL.
+          */
+         feature_indices_t generate_not_features() const
+         {
+            return not_ids();
+         }
+         /*! Creates and returns a collection with the IDs of all
+             or-not-features of all systems of the SPL.
+          */
+         feature_indices_t generate_or_not_features() const
+         {
+            return or_not_ids();
+         }
+         /*! Creates and returns a collection with the IDs of all
+             and-not-features of all systems of the SPL.
+          */
+         feature_indices_t generate_and_not_features() const
+         {
+            return and_not_ids();
+         }
+         /*! Returns a collection with all systems.
+          */
+         const systems_t& all_systems() const
+         {
+            return m_all_systems;
+         }
+         /*! Returns collection with all independent features.
+          */
+         const feature_indices_t& independent_features() const
+         {
+            return m_independent_features;
+         }
+         /*! Returns collection with all or-features.
+          */
+         const feature_indices_t& or_features() const
+         {
+            return m_or_features;
+         }
+         /*! Returns collection with all and-features.
+          */
+         const feature_indices_t& and_features() const
+         {
+            return m_and_features;
+         }
+         /*! Returns collection with all not-features.
+          */
+         const feature_indices_t& not_features() const
+         {
+            return m_not_features;
+         }
+         /*! Returns collection with all or-not-features.
+          */
+         const feature_indices_t& or_not_features() const
+         {
+            return m_or_not_features;
+         }
+         /*! Returns collection with all and-not-features.
+          */
+         const feature_indices_t& and_not_features() const
+         {
+            return m_and_not_features;
+         }
+         /*! Returns collection with the sorted IDs of all features.
+          */
+         const feature_indices_t& all_features() const
+         {
+            return m_all_features;
+         }
+         /*! Returns collection with all feature isolations.
+          */
+         const features_isolation_t& feature_isolations() const
+         {
+            return m_feature_isolations;
+         }
+         /*! Creates and returns collection with all feature isolations.
+             The membership matrix of all systems is transposed, so that
+             the systems that contain a feature form a row of the result.
+             This row is the set difference that isolates the feature.
+          */
+         features_isolation_t generate_feature_isolations() const
+         {
+            const auto phase { instrument().phase("generate_feature_isolations") };
+            features_isolation_t result;
+            const auto columns { membership_matrix_t(all_systems(),feature_table().size()).transpose() };
+            for (const auto f : all_features())
+            {
+               result.insert(std::make_pair(feature_name(f),make_difference(bitset_t(S(),columns.row(f)))));
+            }
+            return result;
+         }
+         /*! Prints results of feature isolation.
+             Takes output stream as parameter with std::cout as default value.
+          */
+         void print_results(std::ostream& os = std::cout) const
+         {
+            const auto phase { instrument().phase("print_results") };
+            const auto start { stream_position(os) };
+            std::string line;
+            for (const auto& e : feature_isolations())
+            {
+               line = e.first;
+               line += separator;
+               append_difference(line,e.second);
+               line += '\n';
+               os.write(line.data(),line.size());
+               instrument().add(0,0,1);
+            }
+            count_bytes(os,start);
+         }
+      private:
+         systems_t            m_all_systems;
+         feature_indices_t    m_independent_features,
+                              m_or_features,
+                              m_and_features,
+                              m_not_features,
+                              m_or_not_features,
+                              m_and_not_features,
+                              m_all_features;
+         features_isolation_t m_feature_isolations;
+   };
+
+   /*! Class that performs feature location analysis
+       by calculating all set differences. In this approach,
+       IDs for set differences are created.
+    */
+  class feature_location_differences_t: public feature_location_isolation_t
+   {
+      public:
+         /*! Constructor that requires the number of idependent features
+             and the number of the model as parameters.
+          */
+         feature_location_differences_t(feature_id_t n_,
+                                        feature_id_t m_,
+                                        const enumeration_options_t& options = { })
+              :feature_location_isolation_t(n_,m_)
+         { 
+            if (!exact_D().fits())
+            {
+               throw std::overflow_error("The " + difference_count() + " set differences of " +
+                                         std::to_string(n_) + " independent features cannot be enumerated.");
+            }
+            m_non_empty_differences = generate_non_empty_differences(options);
+         }
+         /*! Takes a string containing all defining features of a system
+             and returs a set of all features that define the system.
+          */
+         std::set<std::string> system2features(std::string s) const
+         {
+            if (s.length() < system.length() + 1 || s.find(system) != 0)
+            {
+               throw std::logic_error(s + " is not a system identifier.");
+            }
+            std::size_t pos { stoull(s.erase(0,system.size())) };
+            return system_features(pos - 1);
+         }
+         /*! Returns a set of the names of all features that define
+             system s + 1.
+          */
+         std::set<std::string> system_features(maxnat_t s) const
+         {
+            std::set<std::string> result;
+            for (const auto f : all_systems().at(s))
+            {
+               result.insert(feature_name(f));
+            }
+            return result;
+         }
+         /*! Calculates and returns a set difference expression
+             for a single system.
+             Takes total number of systems as parameter.
+          */
+         systems_difference_t generate_difference(maxnat_t s) const
+         {
+            return make_difference(bitset_t(S(),s));
+         }
+         /*! Evaluates the intersection part of a set difference and
+             returns the result.
+             Takes a set difference as parameter.
+          */
+         std::set<std::string> evaluate_intersections(const systems_difference_t& diff) const
+         {
+            std::set<std::string> result;
+            bool first { true };
+            for (maxnat_t s { 0 }; s < S(); ++s)
+            {
+               if (!diff.intersections.test(s))
+               {
+                  continue;
+               }
+               if (first)
+               {
+                  result = system_features(s);
+                  first = false;
+                  continue;
+               }
+               auto left { result };
+               auto right { system_features(s) };
+               result.clear();
+               std::set_intersection(left.begin(),left.end(),
+                                     right.begin(),right.end(),
+                                     std::inserter(result,result.begin()));
+               if (result.size() == 0)
+               {
+                  break;
+               }
+            }
+            return result;
+         }
+         /*! Evaluates the union part of a set difference and
+             returns the result.
+             Takes a set difference as parameter.
+          */
+         std::set<std::string> evaluate_unions(const systems_difference_t& diff) const
+         {
+            std::set<std::string> result;
+            for (maxnat_t s { 0 }; s < S(); ++s)
+            {
+               if (diff.intersections.test(s))
+               {
+                  continue;
+               }
+               auto left { result };
+               auto right { system_features(s) };
+               result.clear();
+               std::set_union(left.begin(),left.end(),
+                              right.begin(),right.end(),
+                              std::inserter(result,result.begin()));
+            }
+            return result;
+         }
+         /*! Evaluates a set difference and returns the result.
+             Takes the set difference as parameter.
+          */
+         std::set<std::string> evaluate_difference(const systems_difference_t& diff) const
+         {
+            auto intersections { evaluate_intersections(diff) };
+            auto unions { evaluate_unions(diff) };
+            std::set<std::string> result;
+            std::set_difference(intersections.begin(),intersections.end(),
+                                unions.begin(),unions.end(),
+                                std::inserter(result,result.begin()));
+
+            return result;
+         }
+         /*! Evaluates all set differences and returns the non-empty ones.
+             The set differences are evaluated with a membership_matrix_t.
+             The range [1,D) is split into chunks, which are evaluated by
+             options.threads threads. The results are merged in the order of
+             the set difference IDs. Hence, they do not depend on the number
+             of threads. If options.checkpoint_file is not empty, the results
+             of each completed prefix of chunks are appended to that file,
+             so that an interrupted enumeration can be resumed.
+          */
+         differences_t generate_non_empty_differences(const enumeration_options_t& options = { }) const
+         {
+            const auto phase { instrument().phase("generate_non_empty_differences") };
+            const membership_matrix_t matrix { all_systems(),feature_table().size() };
+            const maxnat_t chunk_size { options.chunk_size > 0 ? options.chunk_size :
+                                        std::clamp<maxnat_t>(D() / enumeration_options_t::min_chunks,1,1llu << 20) };
+            const maxnat_t chunks { D() > 1 ? (D() - 1 + chunk_size - 1) / chunk_size : 0 };
+            // Pairs of set difference ID and feature id.
+            std::vector<std::pair<maxnat_t,std::size_t>> found;
+            maxnat_t committed { 0 };
+            std::ofstream checkpoint;
+            if (!options.checkpoint_file.empty())
+            {
+               std::uintmax_t valid_size { 0 };
+               committed = read_checkpoint(options.checkpoint_file,chunk_size,found,valid_size);
+               // Records after the last completed chunk are removed, since
+               // they are evaluated and recorded again.
+               if (std::filesystem::exists(options.checkpoint_file))
+               {
+                  std::filesystem::resize_file(options.checkpoint_file,valid_size);
+               }
+               checkpoint.open(options.checkpoint_file,std::ios::app);
+               if (valid_size == 0)
+               {
+                  checkpoint << checkpoint_header(chunk_size) << std::endl;
+               }
+            }
+            const maxnat_t committed_on_start { std::min(committed * chunk_size,D()) };
+            std::atomic<maxnat_t> next_chunk { committed };
+            std::map<maxnat_t,std::vector<std::pair<maxnat_t,std::size_t>>> pending;
+            std::mutex m;
+            std::exception_ptr error { };
+            auto work { [&] ()
+                        {
+                           try
+                           {
+                              difference_evaluator_t evaluate { matrix };
+                              for (maxnat_t c { next_chunk++ }; c < chunks; c = next_chunk++)
+                              {
+                                 std::vector<std::pair<maxnat_t,std::size_t>> chunk_result;
+                                 const maxnat_t first { 1 + c * chunk_size },
+                                                last { std::min(first + chunk_size,D()) };
+                                 for (maxnat_t e { first }; e < last; ++e)
+                                 {
+                                    if (const auto feature { evaluate(e) })
+                                    {
+                                       chunk_result.emplace_back(e,*feature);
+                                    }
+                                 }
+                                 std::lock_guard lock { m };
+                                 pending.emplace(c,std::move(chunk_result));
+                                 for (auto p { pending.begin() };
+                                      p != pending.end() && p->first == committed;
+                                      p = pending.erase(p))
+                                 {
+                                    for (const auto& [e,feature] : p->second)
+                                    {
+                                       found.emplace_back(e,feature);
+                                       if (checkpoint.is_open())
+                                       {
+                                          checkpoint << "R" << separator << e << separator << feature << '\n';
+                                       }
+                                    }
+                                    ++committed;
+                                    if (checkpoint.is_open())
+                                    {
+                                       checkpoint << "C" << separator << committed << std::endl;
+                                    }
+                                 }
+                              }
+                           }
+                           catch (...)
+                           {
+                              std::lock_guard lock { m };
+                              error = std::current_exception();
+                              next_chunk = chunks;
+                           }
+                        }
+                      };
+            std::vector<std::thread> pool;
+            for (unsigned t { 0 }; t < std::max(options.threads,1u); ++t)
+            {
+               pool.emplace_back(work);
+            }
+            for (auto& t : pool)
+            {
+               t.join();
+            }
+            if (error)
+            {
+               std::rethrow_exception(error);
+            }
+            // Each set difference that has not been restored from the checkpoint
+            // has been evaluated once.
+            instrument().add(0,D() > 1 ? D() - 1 - std::min(committed_on_start,D() - 1) : 0);
+            differences_t result { };
+            for (const auto& [e,feature] : found)
+            {
+               result.push_back(system_feature_difference_t { bitset_t(S(),e),
+                                                              feature_name(feature),
+                                                              generate_difference(e) });
+            }
+            return result;
+         }
+         /*! Returns the first line of a checkpoint file, which identifies the enumeration.
+             Takes the chunk size as parameter.
+          */
+         std::string checkpoint_header(maxnat_t chunk_size) const
+         {
+            return "M" + std::to_string(M()) + separator + "F" + std::to_string(F()) +
+                   separator + "D" + std::to_string(D()) + separator + "T" + std::to_string(T()) +
+                   separator + "chunk" + std::to_string(chunk_size);
+         }
+         /*! Reads a checkpoint file, if it exists, and returns the number of
+             chunks that have been completed. Appends the results of these chunks
+             to found. Results after the last completed chunk are ignored,
+             since they may be incomplete, and so is a last line without a line break.
+             Takes name of checkpoint file, chunk size, collection of pairs of set
+             difference ID and feature id, and a variable that receives the number
+             of bytes up to the end of the last completed chunk, or 0 if the header
+             is missing, as parameters.
+          */
+         maxnat_t read_checkpoint(const std::string& file_name,maxnat_t chunk_size,
+                                  std::vector<std::pair<maxnat_t,std::size_t>>& found,
+                                  std::uintmax_t& valid_size) const
+         {
+            valid_size = 0;
+            std::ifstream is { file_name,std::ios::binary };
+            std::string line;
+            if (!is || !std::getline(is,line) || is.eof())
+            {
+               return 0;
+            }
+            if (line != checkpoint_header(chunk_size))
+            {
+               throw std::logic_error(file_name + " belongs to a different enumeration: " + line);
+            }
+            valid_size = static_cast<std::uintmax_t>(is.tellg());
+            maxnat_t result { 0 };
+            std::vector<std::pair<maxnat_t,std::size_t>> uncommitted;
+            while (std::getline(is,line))
+            {
+               std::istringstream record { line };
+               std::string kind;
+               record >> kind;
+               if (kind == "R")
+               {
+                  maxnat_t e { };
+                  std::size_t feature { };
+                  if (record >> e >> feature && feature < feature_table().size())
+                  {
+                     uncommitted.emplace_back(e,feature);
+                  }
+               }
+               else if (kind == "C")
+               {
+                  maxnat_t chunk { };
+                  if (!(record >> chunk) || is.eof())
+                  {
+                     break;
+                  }
+                  concat(found,uncommitted);
+                  uncommitted.clear();
+                  result = chunk;
+                  valid_size = static_cast<std::uintmax_t>(is.tellg());
+               }
+            }
+            return result;
+         }
+         /*! Evaluates all set differences and returns the non-empty ones.
+             This is the reference implementation of generate_non_empty_differences(),
+             which evaluates the set differences with sets of feature names.
+          */
+         differences_t generate_non_empty_differences_with_sets() const
+         {
+            differences_t result { };
+            for (maxnat_t e { 1 }; e < D(); ++e)
+            {
+               const auto& diff { generate_difference(e) };
+               const auto& res { evaluate_difference(diff) };
+               if (res.size() > 0)
+               {
+                  if (res.size() != 1)
+                  {
+                     throw std::length_error("Set size = " + std::to_string(res.size()) +  ", must be 1!");
+                  }
+                  result.push_back(system_feature_difference_t { bitset_t(S(),e),*res.begin(),diff });
+               }
+            }
+            return result;
+         }
+         /*! Returns collection with non-empty set differences.
+          */
+         const differences_t& non_empty_differences() const
+         {
+            return m_non_empty_differences;
+         }
+         /*! Prints results of evaluating all set differences.
+             Takes output stream as parameter with std::cout as default value.
+          */
+         void print_results(std::ostream& os = std::cout) const
+         {
+            const auto phase { instrument().phase("print_results") };
+            const auto start { stream_position(os) };
+            std::string line;
+            for (const auto& e : non_empty_differences())
+            {
+               line = difference_name(e.difference_id);
+               line += separator;
+               line += e.feature;
+               line += separator;
+               append_difference(line,e.difference);
+               line += '\n';
+               os.write(line.data(),line.size());
+               instrument().add(0,0,1);
+            }
+            count_bytes(os,start);
+         }
+         /*! Prints results of evaluating all set differences in the binary format.
+             Takes output stream, which should have been opened in binary mode,
+             and whether the compressed variant is to be printed as parameters.
+          */
+         void print_binary_results(std::ostream& os,bool compressed = false) const
+         {
+            const auto phase { instrument().phase("print_binary_results") };
+            const auto start { stream_position(os) };
+            print_binary(os,F(),M(),"ALL",S(),m_non_empty_differences,compressed);
+            count_bytes(os,start);
+         }
+      private:
+         differences_t m_non_empty_differences;
+   };
+
+   /*! Class that performs feature location analysis
+       by calculating only valid set differences. In this approach,
+       only IDs for valid set differences are created.
+    */
+   class feature_location_calculation_t: public feature_location_t
+   {
+      public:
+         /*! Constructor that requires the number of idependent features
+             and the number of the model as parameters.
+          */
+         feature_location_calculation_t(feature_id_t n_,
+                                        feature_id_t m_)
+              :feature_location_t(n_,m_),
+               m_systems_bitmask { initialize_bitmask() }
+         { 
+            m_independent_features = calculate_independent_features();
+            m_or_features = calculate_or_features();
+            m_and_features = calculate_and_features();
+            m_not_features = calculate_not_features();
+            m_or_not_features = calculate_or_not_features();
+            m_and_not_features = calculate_and_not_features();
+            concat(concat(concat(concat(concat(concat(m_all_features,
+                   m_independent_features),m_or_features),m_and_features),
+                   m_not_features),m_or_not_features),m_and_not_features
+                  );
+            m_differences = calculate_differences();
+         }
+         /*! Constructor that requires the number of independent features, the
+             number of the model, and a result cache as parameters. The feature
+             expressions of each category of the model are taken from the cache
+             if it has an entry for them. Otherwise, they are calculated and stored
+             in the cache. Since the feature expressions of a category are the same
+             in all models that have it, the entries are stored for complete_model
+             and shared by all models.
+          */
+         feature_location_calculation_t(feature_id_t n_,
+                                        feature_id_t m_,
+                                        const result_cache_t& cache)
+              :feature_location_t(n_,m_),
+               m_systems_bitmask { initialize_bitmask() }
+         {
+            using self_t = feature_location_calculation_t;
+            m_independent_features = cached(cache,"F",true,&self_t::calculate_independent_features);
+            m_or_features = cached(cache,"O",hasO(m_),&self_t::calculate_or_features);
+            m_and_features = cached(cache,"A",hasA(m_),&self_t::calculate_and_features);
+            m_not_features = cached(cache,"N",hasN(m_),&self_t::calculate_not_features);
+            m_or_not_features = cached(cache,"ON",hasON(m_),&self_t::calculate_or_not_features);
+            m_and_not_features = cached(cache,"AN",hasAN(m_),&self_t::calculate_and_not_features);
+            concat(concat(concat(concat(concat(concat(m_all_features,
+                   m_independent_features),m_or_features),m_and_features),
+                   m_not_features),m_or_not_features),m_and_not_features
+                  );
+            m_differences = calculate_differences();
+         }
+         /*! Constructor that derives the analysis of model m_ from the analysis
+             superset of the same number of independent features. The model of
+             superset must include all categories of features of m_, for example
+             complete_model. The feature expressions of superset are filtered
+             by the categories of m_, so that none of them is calculated again.
+          */
+         feature_location_calculation_t(const feature_location_calculation_t& superset,
+                                        feature_id_t m_)
+              :feature_location_t(superset.n(),m_),
+               m_systems_bitmask { initialize_bitmask() }
+         {
+            if (!includes_model(superset.M(),m_))
+            {
+               throw std::logic_error("Model " + std::to_string(superset.M()) +
+                                      " does not include model " + std::to_string(m_) + ".");
+            }
+            m_independent_features = superset.m_independent_features;
+            if (hasO(m_))
+            {
+               m_or_features = superset.m_or_features;
+            }
+            if (hasA(m_))
+            {
+               m_and_features = superset.m_and_features;
+            }
+            if (hasN(m_))
+            {
+               m_not_features = superset.m_not_features;
+            }
+            if (hasON(m_))
+            {
+               m_or_not_features = superset.m_or_not_features;
+            }
+            if (hasAN(m_))
+            {
+               m_and_not_features = superset.m_and_not_features;
+            }
+            concat(concat(concat(concat(concat(concat(m_all_features,
+                   m_independent_features),m_or_features),m_and_features),
+                   m_not_features),m_or_not_features),m_and_not_features
+                  );
+            m_differences = calculate_differences();
+         }
+         /*! Returns the feature expressions of category from the entry of cache,
+             or calculates them with calculate and stores them in cache if there is
+             no entry. Returns no feature expressions if present is false, that is,
+             if the model does not have the category.
+          */
+         feature_expression_t cached(const result_cache_t& cache,const std::string& category,bool present,
+                                     feature_expression_t (feature_location_calculation_t::*calculate)() const) const
+         {
+            if (!present)
+            {
+               return { };
+            }
+            if (const auto entry { cache.find(F(),complete_model,category) }; entry && entry->S() == S())
+            {
+               const auto phase { instrument().phase("read_cache") };
+               feature_expression_t result;
+               result.reserve(entry->size());
+               for (std::size_t i { 0 }; i < entry->size(); ++i)
+               {
+                  result.emplace_back(std::string(entry->name(i)),entry->expression(i));
+               }
+               return result;
+            }
+            auto result { (this->*calculate)() };
+            cache.store(F(),complete_model,category,S(),result);
+            return result;
+         }
+         /*! Calculates and returns bit mask that masks
+             non-existant systems.
+             Because a bitset_t has exactly S bits, no bit refers to a
+             non-existant system and the bit mask is empty.
+          */
+         bitset_t initialize_bitmask() const
+         {
+            return bitset_t(S());
+         }
+         /*! Returns bit mask that masks non-existant systems.
+          */
+         const bitset_t& systems_bitmask() const
+         {
+            return m_systems_bitmask;
+         }
+         /*! Calculates and returns set difference.
+             Takes system ID and system name as parameters.
+          */
+         system_feature_difference_t calculate_difference(const bitset_t& index,const std::string& name) const
+         {
+            return system_feature_difference_t { index,name,make_difference(index) };
+         }
+         /*! Evaluates and returns collection with all valid system differences.
+          */
+         differences_t calculate_differences() const
+         {
+            const auto phase { instrument().phase("calculate_differences") };
+            differences_t result;
+            for (const auto& [name,value]  : all_features())
+            {
+               result.push_back(calculate_difference(value,name));
+            }
+            instrument().add(0,result.size());
+            const auto sort_phase { instrument().phase("sort_differences") };
+            sort(result.begin(),result.end(),[] (const auto& a,const auto& b) -> bool { return a.difference_id < b.difference_id; });
+            return result;
+         }
+         /*! Returns collection with valid system differences.
+          */
+         const differences_t& differences() const
+         {
+            return m_differences;
+         }
+         /*! Calculates and returns collection of independent features.
+          */
+         feature_expression_t calculate_independent_features() const
+         {
+            const auto phase { instrument().phase("calculate_independent_features") };
+            feature_expression_t result;
+            for (maxnat_t f { 0 }; f < n(); ++f)
+            {
+               // System s is intersected if bit f of s is set.
+               bitset_t value(S());
+               for (maxnat_t s { 0 }; s < S(); ++s)
+               {
+                  if (s >> f & 1llu)
+                  {
+                     value.set(s);
+                  }
+               }
+               result.push_back(make_pair(independent_feature_name(f + 1),value));
+               instrument().add(0,S());
+            }
+            return result;
+         }
+         /*! Calculates and returns collection of or-features.
+          */
+         feature_expression_t calculate_or_features() const
+         {
+            const auto phase { instrument().phase("calculate_or_features") };
+            feature_expression_t result;
+            if (hasO(M()))
+            {
+               feature_name_buffer_t name { feature_or,false };
+               for (feature_id_t k { 2 }; k <= n(); ++k)
+               {
+                  combination_t combination { raw_independent_features(),k };
+                  do 
+                  {
+                     result.push_back( { name(combination.symbols()), or_feature_value(combination.symbols(),independent_features()) } );
+                     instrument().add(1,k);
+                  } while (combination.next());
+               }
+            }
+            return result;
+         }
+         /*! Calculates and returns collection of and-features.
+          */
+         feature_expression_t calculate_and_features() const
+         {
+            const auto phase { instrument().phase("calculate_and_features") };
+            feature_expression_t result;
+            if (hasA(M()))
+            {
+               feature_name_buffer_t name { feature_and,false };
+               for (feature_id_t k { 2 }; k <= n(); ++k)
+               {
+                  combination_t combination { raw_independent_features(),k };
+                  do 
+                  {
+                     result.push_back( { name(combination.symbols()), and_feature_value(combination.symbols(),independent_features()) } );
+                     instrument().add(1,k);
+                  } while (combination.next());
+               }
+            }
+            return result;
+         }
+         /*! Calculates and returns collection of not-features.
+          */
+         feature_expression_t calculate_not_features() const
+         {
+            const auto phase { instrument().phase("calculate_not_features") };
+            feature_expression_t result;
+            if (hasN(M()))
+            {
+               for (const auto& f : independent_features())
+               {
+                  // Possible source of errors: The following line does not call
+                  // not_feature_name()! Instead it uses feature_not + f.first!
+                  result.push_back(make_pair(feature_not + f.first,~(f.second ^ systems_bitmask())));
+                  instrument().add(0,2);
+               }
+            }
+            return result;
+         }
+         /*! Calculates and returns collection of or-not-features.
+          */
+         feature_expression_t calculate_or_not_features() const
+         {
+            const auto phase { instrument().phase("calculate_or_not_features") };
+            feature_expression_t result;
+            if (hasON(M()))
+            {
+               feature_name_buffer_t name { feature_or,true };
+               for (feature_id_t k { 2 }; k <= n(); ++k)
+               {
+                  combination_t combination { raw_independent_features(),k };
+                  do 
+                  {
+                     result.push_back( { name(combination.symbols()), or_not_feature_value(combination.symbols(),not_features()) } );
+                     instrument().add(1,k);
+                  } while (combination.next());
+               }
+            }
+            return result;
+         }
+         /*! Calculates and returns collection of and-not-features.
+          */
+         feature_expression_t calculate_and_not_features() const
+         {
+            const auto phase { instrument().phase("calculate_and_not_features") };
+            feature_expression_t result;
+            if (hasAN(M()))
+            {
+               feature_name_buffer_t name { feature_and,true };
+               for (feature_id_t k { 2 }; k <= n(); ++k)
+               {
+                  combination_t combination { raw_independent_features(),k };
+                  do 
+                  {
+                     result.push_back( { name(combination.symbols()), and_not_feature_value(combination.symbols(),not_features(),systems_bitmask()) } );
+                     instrument().add(1,k);
+                  } while (combination.next());
+               }
+            }
+            return result;
+         }
+         /*! Returns collection with all independent feature names plus difference ID plus set difference.
+          */
+         const feature_expression_t& independent_features() const
+         {
+            return m_independent_features;
+         }
+         /*! Returns collection with all or-feature names plus difference ID plus set difference.
+          */
+         const feature_expression_t& or_features() const
+         {
+            return m_or_features;
+         }
+         /*! Returns collection with all and-feature names plus difference ID plus set difference.
+          */
+         const feature_expression_t& and_features() const
+         {
+            return m_and_features;
+         }
+         /*! Returns collection with all not-feature names plus difference ID plus set difference.
+          */
+         const feature_expression_t& not_features() const
+         {
+            return m_not_features;
+         }
+         /*! Returns collection with all or-not-feature names plus difference ID plus set difference.
+          */
+         const feature_expression_t& or_not_features() const
+         {
+            return m_or_not_features;
+         }
+         /*! Returns collection with all and-not-feature names plus difference ID plus set difference.
+          */
+         const feature_expression_t& and_not_features() const
+         {
+            return m_and_not_features;
+         }
+         /*! Returns collection with all feature names plus difference ID plus set difference.
+          */
+         const feature_expression_t& all_features() const
+         {
+            return m_all_features;
+         }
+         /*! Prints results of feature isolation.
+             Takes output stream as parameter with std::cout as default value.
+          */
+         void print_results(std::ostream& os = std::cout) const
+         {
+            const auto phase { instrument().phase("print_results") };
+            const auto start { stream_position(os) };
+            std::string line;
+            for (const auto& e : differences())
+            {
+               line = difference_name(e.difference_id);
+               line += separator;
+               line += e.feature;
+               line += separator;
+               append_difference(line,e.difference);
+               line += '\n';
+               os.write(line.data(),line.size());
+               instrument().add(0,0,1);
+            }
+            count_bytes(os,start);
+         }
+         /*! Prints results of feature isolation in the binary format.
+             Takes output stream, which should have been opened in binary mode,
+             and whether the compressed variant is to be printed as parameters.
+          */
+         void print_binary_results(std::ostream& os,bool compressed = false) const
+         {
+            const auto phase { instrument().phase("print_binary_results") };
+            const auto start { stream_position(os) };
+            print_binary(os,F(),M(),"ALL",S(),m_differences,compressed);
+            count_bytes(os,start);
+         }
+      private:
+         const bitset_t m_systems_bitmask;
+         differences_t m_differences;
+         feature_expression_t m_independent_features,
+                              m_or_features,
+                              m_and_features,
+                              m_not_features,
+                              m_or_not_features,
+                              m_and_not_features,
+                              m_all_features;
+   };
+
+   /*! Compile-time traits of model M.
+    */
+   template <model_id_t M>
+   struct model_traits_t
+   {
+      static constexpr bool has_or { hasO(M) },
+                            has_and { hasA(M) },
+                            has_not { hasN(M) },
+                            has_or_not { hasON(M) },
+                            has_and_not { hasAN(M) };
+   };
+
+   /*! Categories of features.
+    */
+   enum class feature_category_t : unsigned char
+   {
+      independent,
+      or_feature,
+      and_feature,
+      not_feature,
+      or_not_feature,
+      and_not_feature
+   };
+
+   /*! Feature of a compile-time calculation table. The feature is
+       identified by its category and the raw IDs of the independent
+       features it is composed of. For example, F1 & F3 is an and-feature
+       with symbols 0b101.
+    */
+   struct table_feature_t
+   {
+      /*! Category of the feature.
+       */
+      feature_category_t category;
+      /*! Raw feature IDs as bits, where bit i - 1 represents raw feature ID i.
+       */
+      maxnat_t symbols;
+      /*! Set difference ID, where bit s is set if system s + 1 is intersected.
+       */
+      maxnat_t difference_id;
+      /*! Returns the name of the feature.
+       */
+      std::string name() const
+      {
+         const auto ids { unsigned2vector(symbols) };
+         switch (category)
+         {
+            case feature_category_t::independent: return independent_feature_name(ids.front());
+            case feature_category_t::or_feature: return or_feature_name(ids);
+            case feature_category_t::and_feature: return and_feature_name(ids);
+            case feature_category_t::not_feature: return not_feature_name(ids.front());
+            case feature_category_t::or_not_feature: return or_not_feature_name(ids);
+            case feature_category_t::and_not_feature: return and_not_feature_name(ids);
+         }
+         throw std::logic_error("Unknown feature category.");
+      }
+   };
+
+   /*! Class template that calculates the valid set differences of model M
+       for F independent features at compile time. It yields the same set
+       differences as feature_location_calculation_t. Because a set difference
+       ID must fit into maxnat_t, F is limited to 6. All members are static,
+       so that a table can be embedded without any computation at startup.
+    */
+   template <feature_id_t F,model_id_t M>
+   class calculation_table_t
+   {
+      static_assert(F >= 1 && F <= 6,"F must be in the range [1,6]!");
+      public:
+         /*! Traits of the model.
+          */
+         using traits = model_traits_t<M>;
+         /*! Number of systems.
+          */
+         static constexpr maxnat_t S { maxnat_t { 1 } << F };
+         /*! Number of dependent features per category, except not-features.
+          */
+         static constexpr maxnat_t dependent { S - F - 1 };
+         /*! Actual total number of features.
+          */
+         static constexpr std::size_t T { F +
+                                          (traits::has_or ? dependent : 0) +
+                                          (traits::has_and ? dependent : 0) +
+                                          (traits::has_not ? F : 0) +
+                                          (traits::has_or_not ? dependent : 0) +
+                                          (traits::has_and_not ? dependent : 0) };
+      private:
+         /*! Returns the set difference ID of a feature.
+          */
+         static constexpr maxnat_t difference_id(feature_category_t category,maxnat_t symbols)
+         {
+            maxnat_t result { 0 };
+            for (maxnat_t s { 0 }; s < S; ++s)
+            {
+               // Bit i - 1 of s is set if system s + 1 has independent feature i.
+               bool intersected { false };
+               switch (category)
+               {
+                  case feature_category_t::independent:
+                  case feature_category_t::or_feature: intersected = (s & symbols) != 0; break;
+                  case feature_category_t::and_feature: intersected = (s & symbols) == symbols; break;
+                  case feature_category_t::not_feature:
+                  case feature_category_t::or_not_feature: intersected = (~s & symbols) != 0; break;
+                  case feature_category_t::and_not_feature: intersected = (~s & symbols) == symbols; break;
+               }
+               if (intersected)
+               {
+                  result |= maxnat_t { 1 } << s;
+               }
+            }
+            return result;
+         }
+         /*! Creates all features, sorted by their set difference IDs.
+          */
+         static constexpr std::array<table_feature_t,T> build()
+         {
+            std::array<table_feature_t,T> result { };
+            std::size_t i { 0 };
+            auto add { [&] (feature_category_t category,maxnat_t symbols)
+                       {
+                          result[i++] = table_feature_t { category,symbols,difference_id(category,symbols) };
+                       }
+                     };
+            for (maxnat_t symbols { 1 }; symbols < S; ++symbols)
+            {
+               if (std::popcount(symbols) == 1)
+               {
+                  add(feature_category_t::independent,symbols);
+                  if (traits::has_not)
+                  {
+                     add(feature_category_t::not_feature,symbols);
+                  }
+                  continue;
+               }
+               if (traits::has_or)
+               {
+                  add(feature_category_t::or_feature,symbols);
+               }
+               if (traits::has_and)
+               {
+                  add(feature_category_t::and_feature,symbols);
+               }
+               if (traits::has_or_not)
+               {
+                  add(feature_category_t::or_not_feature,symbols);
+               }
+               if (traits::has_and_not)
+               {
+                  add(feature_category_t::and_not_feature,symbols);
+               }
+            }
+            std::sort(result.begin(),result.end(),
+                      [] (const auto& a,const auto& b) { return a.difference_id < b.difference_id; });
+            return result;
+         }
+      public:
+         /*! All features, sorted by their set difference IDs.
+          */
+         static constexpr std::array<table_feature_t,T> features { build() };
+         /*! Returns the feature that is isolated by the set difference
+             with ID e, or no value if the set difference is empty.
+          */
+         static constexpr std::optional<table_feature_t> find(maxnat_t e)
+         {
+            const auto p { std::lower_bound(features.cbegin(),features.cend(),e,
+                                            [] (const auto& f,maxnat_t id) { return f.difference_id < id; }) };
+            if (p == features.cend() || p->difference_id != e)
+            {
+               return std::nullopt;
+            }
+            return *p;
+         }
+   };
+
+   /*! Returns true if model M has features of category c and false otherwise.
+    */
+   constexpr bool has_category(model_id_t M,feature_category_t c)
+   {
+      switch (c)
+      {
+         case feature_category_t::independent: return true;
+         case feature_category_t::or_feature: return hasO(M);
+         case feature_category_t::and_feature: return hasA(M);
+         case feature_category_t::not_feature: return hasN(M);
+         case feature_category_t::or_not_feature: return hasON(M);
+         case feature_category_t::and_not_feature: return hasAN(M);
+      }
+      return false;
+   }
+
+   /*! Parses the name of a feature with F independent features, for example
+       "!f1 + !f3", and returns its category and its raw feature IDs as bits,
+       where bit i - 1 represents raw feature ID i. The name must be written
+       as by the *_feature_name() functions, that is, with ascending raw feature
+       IDs. Throws if it is not.
+    */
+   std::pair<feature_category_t,maxnat_t> parse_feature_name(std::string_view name,feature_id_t F)
+   {
+      auto fail { [&] () { throw std::invalid_argument(std::string(name) + " is not a feature name."); } };
+      std::vector<feature_id_t> ids;
+      std::string_view op { };
+      bool negated { false };
+      for (std::size_t position { 0 }; ; )
+      {
+         const auto end { std::min(name.find(feature_separator,position),name.size()) };
+         std::string_view operand { name.substr(position,end - position) };
+         const bool not_operand { operand.starts_with(feature_not) };
+         if (not_operand)
+         {
+            operand.remove_prefix(feature_not.size());
+         }
+         if ((!ids.empty() && not_operand != negated) || !operand.starts_with(feature) ||
+             operand.size() == feature.size() ||
+             operand.find_first_not_of("0123456789",feature.size()) != std::string_view::npos)
+         {
+            fail();
+         }
+         negated = not_operand;
+         const auto digits { operand.substr(feature.size()) };
+         maxnat_t i { 0 };
+         if (std::from_chars(digits.data(),digits.data() + digits.size(),i).ec != std::errc { } ||
+             i < 1 || i > F || (!ids.empty() && i <= ids.back()))
+         {
+            fail();
+         }
+         ids.push_back(static_cast<feature_id_t>(i));
+         if (end == name.size())
+         {
+            break;
+         }
+         // Operator between two separators.
+         const auto next { name.find(feature_separator,end + feature_separator.size()) };
+         if (next == std::string_view::npos)
+         {
+            fail();
+         }
+         const auto o { name.substr(end + feature_separator.size(),next - end - feature_separator.size()) };
+         if ((o != feature_or && o != feature_and) || (!op.empty() && o != op))
+         {
+            fail();
+         }
+         op = o;
+         position = next + feature_separator.size();
+      }
+      const maxnat_t symbols { vector2unsigned(ids) };
+      if (ids.size() == 1)
+      {
+         return { negated ? feature_category_t::not_feature : feature_category_t::independent,symbols };
+      }
+      if (op == feature_or)
+      {
+         return { negated ? feature_category_t::or_not_feature : feature_category_t::or_feature,symbols };
+      }
+      return { negated ? feature_category_t::and_not_feature : feature_category_t::and_feature,symbols };
+   }
+
+   /*! Returns the difference expression of independent feature i for F
+       independent features, that is, the systems that have feature i.
+       The words are set directly, so that no system is examined.
+    */
+   bitset_t independent_feature_value(feature_id_t F,feature_id_t i)
+   {
+      // Bits of the systems with feature i in a word if i <= 6.
+      constexpr bitset_t::word_t patterns[] { 0xAAAAAAAAAAAAAAAAllu,
+                                              0xCCCCCCCCCCCCCCCCllu,
+                                              0xF0F0F0F0F0F0F0F0llu,
+                                              0xFF00FF00FF00FF00llu,
+                                              0xFFFF0000FFFF0000llu,
+                                              0xFFFFFFFF00000000llu };
+      const maxnat_t S { power2(F) };
+      std::vector<bitset_t::word_t> words((S + bitset_t::word_bits - 1) / bitset_t::word_bits);
+      for (std::size_t w { 0 }; w < words.size(); ++w)
+      {
+         words[w] = i <= 6 ? patterns[i - 1] : (w >> (i - 7) & 1 ? ~bitset_t::word_t { 0 } : 0);
+      }
+      return bitset_t(S,words);
+   }
+
+   /*! Calculates and returns the difference expression of a single feature
+       of model M with F independent features, without calculating any other
+       feature. Takes the name of the feature, see parse_feature_name().
+       Throws if the model has no features of its category.
+    */
+   bitset_t feature_value(feature_id_t F,model_id_t M,std::string_view name)
+   {
+      const auto [category,symbols] { parse_feature_name(name,F) };
+      if (!has_category(M,category))
+      {
+         throw std::logic_error("Model " + std::to_string(M) + " has no feature " + std::string(name) + ".");
+      }
+      const bool negated { category == feature_category_t::not_feature ||
+                           category == feature_category_t::or_not_feature ||
+                           category == feature_category_t::and_not_feature };
+      const bool conjunction { category == feature_category_t::and_feature ||
+                               category == feature_category_t::and_not_feature };
+      std::optional<bitset_t> result;
+      for (const auto i : unsigned2vector(symbols))
+      {
+         auto value { independent_feature_value(F,i) };
+         if (negated)
+         {
+            value.flip();
+         }
+         if (!result)
+         {
+            result = std::move(value);
+         }
+         else if (conjunction)
+         {
+            *result &= value;
+         }
+         else
+         {
+            *result |= value;
+         }
+      }
+      return *result;
+   }
+
+   /*! Read-only view of all features of F independent features and model M
+       with their set differences. The features are created category by category,
+       directly from combination_t, when the view is iterated, and they are not
+       stored. They are yielded in the order of all_features() of
+       feature_location_calculation_t and have the same values. Only the
+       independent features and the not-features, 2 * F in total, are stored.
+    */
+   class feature_expression_view_t
+   {
+      public:
+         /*! Type alias for a feature name plus its set difference.
+          */
+         using value_type = feature_expression_t::value_type;
+         /*! Input iterator that creates the features.
+          */
+         class iterator
+         {
+            public:
+               using iterator_category = std::input_iterator_tag;
+               using value_type        = feature_expression_view_t::value_type;
+               using difference_type   = std::ptrdiff_t;
+               using pointer           = const value_type*;
+               using reference         = const value_type&;
+               /*! Default constructor required by input iterators.
+                */
+               iterator() = default;
+               /*! Constructor that requires the view and the position of the
+                   current feature, which is size() for the end of the view.
+                */
+               iterator(const feature_expression_view_t* view,maxnat_t position)
+                  :m_view { view },
+                   m_position { position }
+               {
+                  if (m_position < m_view->size())
+                  {
+                     enter(0);
+                  }
+               }
+               /*! Returns the current feature, which remains valid until the iterator is incremented.
+                */
+               const value_type& operator*() const
+               {
+                  return m_current;
+               }
+               const value_type* operator->() const
+               {
+                  return &m_current;
+               }
+               iterator& operator++()
+               {
+                  advance();
+                  return *this;
+               }
+               iterator operator++(int)
+               {
+                  auto result { *this };
+                  advance();
+                  return result;
+               }
+               bool operator==(const iterator& right) const
+               {
+                  return m_position == right.m_position;
+               }
+            private:
+               /*! Returns true if the category with index c consists of a
+                   single independent feature per feature.
+                */
+               static bool single(std::size_t c)
+               {
+                  return order[c] == feature_category_t::independent ||
+                         order[c] == feature_category_t::not_feature;
+               }
+               /*! Moves to the first feature of the first category with index c or above
+                   that model M has.
+                */
+               void enter(std::size_t c)
+               {
+                  for (m_category = c; m_category < order.size(); ++m_category)
+                  {
+                     if (!has_category(m_view->M(),order[m_category]))
+                     {
+                        continue;
+                     }
+                     if (single(m_category) && m_view->F() > 0)
+                     {
+                        m_i = 0;
+                        load();
+                        return;
+                     }
+                     if (!single(m_category) && m_view->F() > 1)
+                     {
+                        m_k = 2;
+                        m_combination.emplace(m_view->m_symbols,m_k);
+                        load();
+                        return;
+                     }
+                  }
+               }
+               /*! Moves to the next feature.
+                */
+               void advance()
+               {
+                  if (++m_position >= m_view->size())
+                  {
+                     m_position = m_view->size();
+                     return;
+                  }
+                  if (single(m_category))
+                  {
+                     if (++m_i < m_view->F())
+                     {
+                        load();
+                        return;
+                     }
+                  }
+                  else if (m_combination->next())
+                  {
+                     load();
+                     return;
+                  }
+                  else if (++m_k <= m_view->F())
+                  {
+                     m_combination.emplace(m_view->m_symbols,m_k);
+                     load();
+                     return;
+                  }
+                  enter(m_category + 1);
+               }
+               /*! Creates the current feature.
+                */
+               void load()
+               {
+                  const auto& independent { m_view->m_independent_features };
+                  const auto& negated { m_view->m_not_features };
+                  switch (order[m_category])
+                  {
+                     case feature_category_t::independent:
+                        m_current = independent[m_i];
+                        break;
+                     case feature_category_t::not_feature:
+                        m_current = negated[m_i];
+                        break;
+                     case feature_category_t::or_feature:
+                        m_current.first = m_names[m_category](m_combination->symbols());
+                        m_current.second = or_feature_value(m_combination->symbols(),independent);
+                        break;
+                     case feature_category_t::and_feature:
+                        m_current.first = m_names[m_category](m_combination->symbols());
+                        m_current.second = and_feature_value(m_combination->symbols(),independent);
+                        break;
+                     case feature_category_t::or_not_feature:
+                        m_current.first = m_names[m_category](m_combination->symbols());
+                        m_current.second = or_not_feature_value(m_combination->symbols(),negated);
+                        break;
+                     case feature_category_t::and_not_feature:
+                        m_current.first = m_names[m_category](m_combination->symbols());
+                        m_current.second = and_not_feature_value(m_combination->symbols(),negated,m_view->m_bitmask);
+                        break;
+                  }
+               }
+               /*! Order of the categories, which is the order of all_features()
+                   of feature_location_calculation_t.
+                */
+               static constexpr std::array<feature_category_t,6> order
+               {
+                  feature_category_t::independent,
+                  feature_category_t::or_feature,
+                  feature_category_t::and_feature,
+                  feature_category_t::not_feature,
+                  feature_category_t::or_not_feature,
+                  feature_category_t::and_not_feature
+               };
+               const feature_expression_view_t* m_view { nullptr };
+               maxnat_t m_position { 0 };
+               std::size_t m_category { 0 };
+               feature_id_t m_i { 0 };
+               feature_id_t m_k { 0 };
+               std::optional<combination_t<feature_id_t>> m_combination;
+               /*! Name buffers of the categories in the order of order.
+                */
+               std::array<feature_name_buffer_t,6> m_names
+               {
+                  feature_name_buffer_t { feature_or,false },
+                  feature_name_buffer_t { feature_or,false },
+                  feature_name_buffer_t { feature_and,false },
+                  feature_name_buffer_t { feature_or,true },
+                  feature_name_buffer_t { feature_or,true },
+                  feature_name_buffer_t { feature_and,true }
+               };
+               value_type m_current;
+         };
+         /*! Constructor that requires the number of independent features
+             and the number of the model as parameters.
+          */
+         feature_expression_view_t(feature_id_t F,model_id_t M)
+            :m_F { F },
+             m_M { M },
+             m_bitmask(power2(F))
+         {
+            if (F >= sizeof(maxnat_t) * CHAR_BIT)
+            {
+               throw std::overflow_error("The number of systems of " + std::to_string(F) +
+                                         " independent features does not fit into maxnat_t.");
+            }
+            for (feature_id_t f { 1 }; f <= F; ++f)
+            {
+               m_symbols.push_back(f);
+               m_independent_features.emplace_back(independent_feature_name(f),independent_feature_value(F,f));
+               m_not_features.emplace_back(feature_not + m_independent_features.back().first,
+                                           ~(m_independent_features.back().second ^ m_bitmask));
+            }
+            const maxnat_t combinations { F < 2 ? 0 : sum_of_combinations(F,2) };
+            m_size = F + (hasN(M) ? F : 0) +
+                     combinations * (hasO(M) + hasA(M) + hasON(M) + hasAN(M));
+         }
+         /*! Returns the number of independent features.
+          */
+         feature_id_t F() const
+         {
+            return m_F;
+         }
+         /*! Returns the number of the model.
+          */
+         model_id_t M() const
+         {
+            return m_M;
+         }
+         iterator begin() const
+         {
+            return iterator { this,0 };
+         }
+         iterator end() const
+         {
+            return iterator { this,m_size };
+         }
+         /*! Returns the total number of features.
+          */
+         maxnat_t size() const
+         {
+            return m_size;
+         }
+      private:
+         feature_id_t m_F;
+         model_id_t m_M;
+         bitset_t m_bitmask;
+         maxnat_t m_size { 0 };
+         std::vector<feature_id_t> m_symbols;
+         feature_expression_t m_independent_features,
+                              m_not_features;
+   };
+
+   /*! Hash index from difference expressions to feature names for reverse
+       lookup. It uses open addressing with linear probing and keeps its load
+       factor at most 1/2.
+    */
+   class expression_index_t
+   {
+      public:
+         /*! Default constructor that creates an empty index.
+          */
+         expression_index_t() = default;
+         /*! Constructor that indexes a collection of feature names
+             and their difference expressions.
+          */
+         explicit expression_index_t(const feature_expression_t& features)
+         {
+            reserve(features.size());
+            for (const auto& [name,value] : features)
+            {
+               insert(value,name);
+            }
+         }
+         /*! Constructor that indexes the features of a view while they are created,
+             so that no collection of all features is required.
+          */
+         explicit expression_index_t(const feature_expression_view_t& features)
+         {
+            reserve(features.size());
+            for (const auto& [name,value] : features)
+            {
+               insert(value,name);
+            }
+         }
+         /*! Constructor that indexes the features of non-empty set differences.
+          */
+         explicit expression_index_t(const differences_t& differences)
+         {
+            reserve(differences.size());
+            for (const auto& d : differences)
+            {
+               insert(d.difference_id,d.feature);
+            }
+         }
+         /*! Prepares the index for n entries.
+          */
+         void reserve(std::size_t n)
+         {
+            m_entries.reserve(n);
+            if (2 * n > m_slots.size())
+            {
+               rehash(std::bit_ceil(std::max<std::size_t>(2 * n,16)));
+            }
+         }
+         /*! Adds the feature with the given name that is isolated by expression.
+             Throws if expression already isolates another feature.
+          */
+         void insert(const bitset_t& expression,const std::string& name)
+         {
+            if (2 * (m_entries.size() + 1) > m_slots.size())
+            {
+               rehash(std::max<std::size_t>(2 * m_slots.size(),16));
+            }
+            auto& slot { m_slots[probe(expression)] };
+            if (slot != 0)
+            {
+               throw std::logic_error(name + " and " + m_entries[slot - 1].second +
+                                      " have the same difference expression.");
+            }
+            m_entries.emplace_back(expression,name);
+            slot = static_cast<std::uint32_t>(m_entries.size());
+         }
+         /*! Returns the name of the feature that is isolated by expression,
+             or no value if there is none.
+          */
+         std::optional<std::string_view> find(const bitset_t& expression) const
+         {
+            if (m_slots.empty())
+            {
+               return std::nullopt;
+            }
+            if (const auto slot { m_slots[probe(expression)] }; slot != 0)
+            {
+               return m_entries[slot - 1].second;
+            }
+            return std::nullopt;
+         }
+         /*! Returns the number of entries.
+          */
+         std::size_t size() const
+         {
+            return m_entries.size();
+         }
+      private:
+         /*! Returns a hash value of expression that depends on all its words.
+          */
+         static std::uint64_t hash(const bitset_t& expression)
+         {
+            std::uint64_t result { expression.size() };
+            for (const auto w : expression.words())
+            {
+               // Mixing function of splitmix64.
+               std::uint64_t z { result ^ w };
+               z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9llu;
+               z = (z ^ (z >> 27)) * 0x94D049BB133111EBllu;
+               result = z ^ (z >> 31);
+            }
+            return result;
+         }
+         /*! Returns the slot that holds expression, or the empty slot
+             where it has to be inserted.
+          */
+         std::size_t probe(const bitset_t& expression) const
+         {
+            const std::size_t mask { m_slots.size() - 1 };
+            std::size_t i { hash(expression) & mask };
+            while (m_slots[i] != 0 && m_entries[m_slots[i] - 1].first != expression)
+            {
+               i = (i + 1) & mask;
+            }
+            return i;
+         }
+         /*! Rebuilds the slots with capacity slots, which must be a power of 2.
+          */
+         void rehash(std::size_t capacity)
+         {
+            m_slots.assign(capacity,0);
+            for (std::size_t e { 0 }; e < m_entries.size(); ++e)
+            {
+               m_slots[probe(m_entries[e].first)] = static_cast<std::uint32_t>(e + 1);
+            }
+         }
+         std::vector<std::pair<bitset_t,std::string>> m_entries;
+         // Index of entry + 1, or 0 if the slot is empty.
+         std::vector<std::uint32_t> m_slots;
+   };
+
+   /*! Engines whose capacity is planned. fl is the program fl.cpp,
+       which always calculates model M19 and writes a file per category.
+    */
+   enum class engine_t : unsigned char
+   {
+      isolation,
+      differences,
+      calculation,
+      fl
+   };
+
+   /*! Returns the name of engine e.
+    */
+   std::string engine_name(engine_t e)
+   {
+      switch (e)
+      {
+         case engine_t::isolation: return "isolation";
+         case engine_t::differences: return "differences";
+         case engine_t::calculation: return "calculation";
+         case engine_t::fl: return "fl";
+      }
+      return "";
+   }
+
+   /*! Returns the symbol of category c, as used in the file names of fl.cpp.
+    */
+   std::string category_symbol(feature_category_t c)
+   {
+      switch (c)
+      {
+         case feature_category_t::independent: return "F";
+         case feature_category_t::or_feature: return "O";
+         case feature_category_t::and_feature: return "A";
+         case feature_category_t::not_feature: return "N";
+         case feature_category_t::or_not_feature: return "ON";
+         case feature_category_t::and_not_feature: return "AN";
+      }
+      return "";
+   }
+
+   /*! Seconds per unit of work of each engine, where a unit is a bit of a
+       difference expression, that is, T * S for isolation and calculation,
+       D * S for differences, and 4 * (2^F - F - 1) * S for fl.
+       The default values have been measured with an optimized build and may
+       be replaced by the results of feature_benchmark.cpp or fl --benchmark.
+    */
+   struct calibration_t
+   {
+      double isolation { 3.3e-8 },
+             differences { 5e-9 },
+             calculation { 1e-9 },
+             fl { 2e-9 },
+             fl_binary { 1e-10 };
+   };
+
+   /*! Returns the physical memory of the computer in bytes, or 0 if it is not available.
+    */
+   maxnat_t physical_memory()
+   {
+#if defined(__unix__) || defined(__APPLE__)
+      const long pages { sysconf(_SC_PHYS_PAGES) },
+                 page_size { sysconf(_SC_PAGE_SIZE) };
+      if (pages > 0 && page_size > 0)
+      {
+         return static_cast<maxnat_t>(pages) * static_cast<maxnat_t>(page_size);
+      }
+#endif
+      return 0;
+   }
+
+   /*! Result of checking whether an engine can finish its work.
+       If feasible is false, the work must not be started and reason tells why.
+       If feasible is true and reason is not empty, it is a warning.
+    */
+   struct feasibility_t
+   {
+      bool feasible { true };
+      std::string reason;
+   };
+
+   /*! Plan of the capacity that is required for feature location analysis
+       of F independent features and model M. All counts are calculated in
+       closed form with exact_count_t before any work is done, so that they
+       are exact or known to have overflowed, but never wrong.
+       Memory and runtime are estimates, whereas the counts and the sizes
+       of the files of fl.cpp are exact.
+    */
+   class capacity_plan_t
+   {
+      public:
+         /*! Constructor that requires the number of independent features
+             and the number of the model and accepts a calibration as parameters.
+          */
+         capacity_plan_t(feature_id_t F,model_id_t M,const calibration_t& calibration = { })
+            :m_F { F },
+             m_M { M },
+             m_calibration { calibration }
+         {
+            m_S = exact_power2(F);
+            for (maxnat_t k { 2 }; k <= F; ++k)
+            {
+               m_combinations = m_combinations + exact_combinations(F,k);
+               m_operators = m_operators + exact_combinations(F,k) * (k - 1);
+            }
+            m_O = hasO(M) ? m_combinations : 0;
+            m_A = hasA(M) ? m_combinations : 0;
+            m_N = hasN(M) ? F : 0;
+            m_ON = hasON(M) ? m_combinations : 0;
+            m_AN = hasAN(M) ? m_combinations : 0;
+            m_DF = m_O + m_A + m_N + m_ON + m_AN;
+            m_T = m_DF + F;
+            m_D = m_S.fits() ? exact_power2(m_S.to_maxnat()) : exact_count_t::overflowed();
+            for (maxnat_t i { 1 }; i <= F; ++i)
+            {
+               m_digits = m_digits + std::to_string(i).size();
+            }
+            // Each independent feature occurs in 2^(F - 1) - 1 combinations with k >= 2.
+            m_occurrences = F >= 1 ? exact_power2(F - 1) - 1 : 0;
+         }
+         /*! Returns the number of independent features.
+          */
+         feature_id_t F() const
+         {
+            return m_F;
+         }
+         /*! Returns the number of the model.
+          */
+         model_id_t M() const
+         {
+            return m_M;
+         }
+         /*! Returns the number of systems of the SPL.
+          */
+         const exact_count_t& S() const
+         {
+            return m_S;
+         }
+         /*! Returns the number of or-features.
+          */
+         const exact_count_t& O() const
+         {
+            return m_O;
+         }
+         /*! Returns the number of and-features.
+          */
+         const exact_count_t& A() const
+         {
+            return m_A;
+         }
+         /*! Returns the number of not-features.
+          */
+         const exact_count_t& N() const
+         {
+            return m_N;
+         }
+         /*! Returns the number of or-not-features.
+          */
+         const exact_count_t& ON() const
+         {
+            return m_ON;
+         }
+         /*! Returns the number of and-not-features.
+          */
+         const exact_count_t& AN() const
+         {
+            return m_AN;
+         }
+         /*! Returns the number of inherently dependent features.
+          */
+         const exact_count_t& DF() const
+         {
+            return m_DF;
+         }
+         /*! Returns the total number of features.
+          */
+         const exact_count_t& T() const
+         {
+            return m_T;
+         }
+         /*! Returns the number of all set differences of the systems.
+          */
+         const exact_count_t& D() const
+         {
+            return m_D;
+         }
+         /*! Returns the number of features of category c.
+          */
+         exact_count_t features(feature_category_t c) const
+         {
+            switch (c)
+            {
+               case feature_category_t::independent: return m_F;
+               case feature_category_t::or_feature: return m_O;
+               case feature_category_t::and_feature: return m_A;
+               case feature_category_t::not_feature: return m_N;
+               case feature_category_t::or_not_feature: return m_ON;
+               case feature_category_t::and_not_feature: return m_AN;
+            }
+            return 0;
+         }
+         /*! Returns the total length of the names of all features of category c,
+             for operators of the given length, which is 1 in fl.cpp, for example f1*f2,
+             and 3 in this file, for example f1 * f2.
+          */
+         exact_count_t name_bytes(feature_category_t c,maxnat_t operator_length) const
+         {
+            const bool negated { c == feature_category_t::not_feature ||
+                                 c == feature_category_t::or_not_feature ||
+                                 c == feature_category_t::and_not_feature };
+            if (features(c).value() == 0 && !features(c).overflow())
+            {
+               return 0;
+            }
+            if (c == feature_category_t::independent || c == feature_category_t::not_feature)
+            {
+               return exact_count_t { negated ? 2u : 1u } * m_F + m_digits;
+            }
+            return exact_count_t { negated ? 2u : 1u } * m_F * m_occurrences +
+                   m_occurrences * m_digits + m_operators * operator_length;
+         }
+         /*! Returns the size of the CSV file of fl.cpp for category c in bytes,
+             or 0 if model M has no features of category c.
+          */
+         exact_count_t csv_bytes(feature_category_t c) const
+         {
+            if (!has_category(m_M,c))
+            {
+               return 0;
+            }
+            // Each line consists of name, tab, S bits, and newline.
+            return name_bytes(c,1) + features(c) * (m_S + 2);
+         }
+         /*! Returns the size of the binary file of fl.cpp for category c in bytes,
+             or 0 if model M has no features of category c.
+          */
+         exact_count_t binary_bytes(feature_category_t c) const
+         {
+            if (!has_category(m_M,c))
+            {
+               return 0;
+            }
+            // Header, packed words, offsets of names, and names.
+            return exact_count_t { sizeof(binary_header_t) } + features(c) * stride() +
+                   (features(c) + 1) * sizeof(std::uint64_t) + name_bytes(c,1);
+         }
+         /*! Returns the estimated peak memory of engine e in bytes.
+          */
+         exact_count_t memory(engine_t e) const
+         {
+            // Every feature has a name, a bitset, and its raw feature IDs.
+            const exact_count_t bitset { stride() + sizeof(bitset_t) },
+                                names { total_name_bytes() + m_T * sizeof(std::string) },
+                                base { names + m_T * (sizeof(std::vector<feature_id_t>) + sizeof(maxnat_t)) +
+                                       m_occurrences * m_F * sizeof(feature_id_t) };
+            // Systems list on average half of the features, the membership matrix
+            // is stored once per system and once per feature.
+            const exact_count_t isolation { base + m_S * (m_T * sizeof(feature_index_t) / 2 + sizeof(feature_indices_t)) +
+                                            m_S * m_T / 4 + m_T * bitset + names };
+            // The results are written by an async_ofstream_t, fl writes four files at once.
+            const exact_count_t writer { async_blocks * async_block_size };
+            switch (e)
+            {
+               case engine_t::isolation:
+                  return isolation + writer;
+               case engine_t::differences:
+                  return isolation + m_T * (bitset * 2) + names + writer;
+               case engine_t::calculation:
+                  // Each feature expression is stored per category and in all features,
+                  // each set difference stores its ID and its difference, and sorting
+                  // the set differences requires temporary copies.
+                  return base + m_T * (bitset * 5) + names * 3 + writer;
+               case engine_t::fl:
+                  // Patterns, negated patterns, and partial results of both evaluators,
+                  // plus one line per category.
+                  return exact_count_t { 4llu * m_F + 8 } * stride() + (m_S + 64) * 4 + writer * 4;
+            }
+            return 0;
+         }
+         /*! Returns the units of work of engine e, see calibration_t.
+          */
+         exact_count_t work(engine_t e) const
+         {
+            switch (e)
+            {
+               case engine_t::isolation:
+               case engine_t::calculation:
+                  return m_T * m_S;
+               case engine_t::differences:
+                  return m_D * m_S;
+               case engine_t::fl:
+                  return m_combinations * 4 * m_S;
+            }
+            return 0;
+         }
+         /*! Returns the estimated runtime of engine e in seconds.
+             If binary is true, the runtime of fl --binary is returned for engine_t::fl.
+          */
+         double seconds(engine_t e,bool binary = false) const
+         {
+            double per_unit { 0 };
+            switch (e)
+            {
+               case engine_t::isolation: per_unit = m_calibration.isolation; break;
+               case engine_t::differences: per_unit = m_calibration.differences; break;
+               case engine_t::calculation: per_unit = m_calibration.calculation; break;
+               case engine_t::fl: per_unit = binary ? m_calibration.fl_binary : m_calibration.fl; break;
+            }
+            return work(e).to_double() * per_unit;
+         }
+         /*! Checks whether engine e can finish its work. It cannot, if a count that
+             it requires does not fit into maxnat_t or if its estimated memory exceeds
+             memory_limit, where 0 means no limit. A warning is given if its estimated
+             runtime exceeds time_limit seconds.
+          */
+         feasibility_t check(engine_t e,maxnat_t memory_limit = physical_memory(),double time_limit = 3600) const
+         {
+            feasibility_t result { };
+            const exact_count_t required { e == engine_t::differences ? m_D : m_T * m_S };
+            if (!required.fits() || m_F >= sizeof(maxnat_t) * CHAR_BIT)
+            {
+               result.feasible = false;
+               result.reason = "The counts of " + std::to_string(m_F) + " independent features do not fit into maxnat_t.";
+            }
+            else if (memory_limit && exact_count_t { memory_limit } < memory(e))
+            {
+               result.feasible = false;
+               result.reason = "The estimated memory of " + memory(e).to_string() +
+                               " bytes exceeds the physical memory of " + std::to_string(memory_limit) + " bytes.";
+            }
+            else if (seconds(e) > time_limit)
+            {
+               result.reason = "The estimated runtime is " + std::to_string(seconds(e)) + " seconds.";
+            }
+            return result;
+         }
+         /*! Prints the plan in the format of print_header() of feature_location_t,
+             that is, one value per line followed by its symbol and its description.
+             Takes output stream as parameter with std::cout as default value.
+          */
+         void print(std::ostream& os = std::cout) const
+         {
+            os << "M" << m_M << separator << "selected model\n"
+               << m_T << separator << "T" << separator << "actual total number of features\n"
+               << m_F << separator << "F" << separator << "number of independent features\n"
+               << m_DF << separator << "DF" << separator << "actual total number of inherently dependent features\n"
+               << m_O << separator << "O" << separator << "actual number of or-features\n"
+               << m_A << separator << "A" << separator << "actual number of and-features\n"
+               << m_N << separator << "N" << separator << "actual number of not-features\n"
+               << m_ON << separator << "ON" << separator << "actual number of or-not-features\n"
+               << m_AN << separator << "AN" << separator << "actual number of and-not-features\n"
+               << m_S << separator << "S" << separator << "number of systems of SPL\n"
+               << (m_D.overflow() && m_S.fits() ? "2^" + m_S.to_string() : m_D.to_string())
+               << separator << "D" << separator << "number of all set differences of SPL systems\n";
+            for (const auto c : { feature_category_t::independent,feature_category_t::not_feature,
+                                  feature_category_t::and_feature,feature_category_t::or_feature,
+                                  feature_category_t::and_not_feature,feature_category_t::or_not_feature })
+            {
+               const std::string file { "fl_" + std::to_string(m_F) + "_" + category_symbol(c) };
+               os << csv_bytes(c) << separator << file << ".csv" << separator << "bytes of CSV file\n"
+                  << binary_bytes(c) << separator << file << ".bin" << separator << "bytes of binary file\n";
+            }
+            for (const auto e : { engine_t::isolation,engine_t::differences,engine_t::calculation,engine_t::fl })
+            {
+               const auto f { check(e) };
+               os << memory(e) << separator << "memory_" << engine_name(e) << separator << "estimated peak memory in bytes\n"
+                  << seconds(e) << separator << "seconds_" << engine_name(e) << separator << "estimated runtime in seconds\n"
+                  << (f.feasible ? (f.reason.empty() ? "feasible" : "slow") : "infeasible") << separator
+                  << "status_" << engine_name(e) << separator << f.reason << "\n";
+            }
+         }
+      private:
+         /*! Returns the number of bytes of a packed difference expression.
+          */
+         exact_count_t stride() const
+         {
+            return (m_S + (bitset_t::word_bits - 1)) / bitset_t::word_bits * sizeof(bitset_t::word_t);
+         }
+         /*! Returns the total length of the names of all features of model M.
+          */
+         exact_count_t total_name_bytes() const
+         {
+            exact_count_t result { 0 };
+            for (const auto c : { feature_category_t::independent,feature_category_t::or_feature,
+                                  feature_category_t::and_feature,feature_category_t::not_feature,
+                                  feature_category_t::or_not_feature,feature_category_t::and_not_feature })
+            {
+               if (has_category(m_M,c))
+               {
+                  result = result + name_bytes(c,feature_separator.size() * 2 + 1);
+               }
+            }
+            return result;
+         }
+         feature_id_t m_F;
+         model_id_t m_M;
+         calibration_t m_calibration;
+         // m_digits is the total number of digits of the IDs of the independent features,
+         // m_occurrences the number of dependent features per independent feature,
+         // and m_operators the total number of operators of the names of a category.
+         exact_count_t m_S,
+                       m_combinations,
+                       m_O,
+                       m_A,
+                       m_N,
+                       m_ON,
+                       m_AN,
+                       m_DF,
+                       m_T,
+                       m_D,
+                       m_digits,
+                       m_occurrences,
+                       m_operators;
+   };
+
+   /*! Checks whether engine e can finish the analysis that is planned by plan
+       and prints the reason to os if it cannot or if it is slow.
+       Returns false if the analysis must not be started.
+    */
+   bool preflight(const capacity_plan_t& plan,engine_t e,std::ostream& os = std::cerr)
+   {
+      const auto f { plan.check(e) };
+      if (!f.reason.empty())
+      {
+         os << (f.feasible ? "Warning: " : "Refused: ") << f.reason << std::endl;
+      }
+      return f.feasible;
+   }
+
+   /*! Returns a calibration that is read from the tab-separated results of
+       feature_benchmark.cpp or fl --benchmark. For each engine, the case with
+       the most units of work over all models determines the seconds per unit.
+       Engines without a case keep the values of defaults.
+    */
+   calibration_t read_calibration(std::istream& is,const calibration_t& defaults = { })
+   {
+      calibration_t result { defaults };
+      std::map<const double*,exact_count_t> units;
+      std::string line;
+      while (std::getline(is,line))
+      {
+         std::istringstream fields { line };
+         std::string name,
+                     parameter;
+         maxnat_t F { };
+         maxnat_t items { };
+         double seconds { };
+         if (!std::getline(fields,name,'\t') || !std::getline(fields,parameter,'\t') ||
+             !(fields >> F >> items >> seconds) || F == 0 || F >= 64)
+         {
+            continue;
+         }
+         double* per_unit { nullptr };
+         exact_count_t u { };
+         if (name == "isolation" || name == "differences" || name == "calculation")
+         {
+            const capacity_plan_t plan { static_cast<feature_id_t>(F),static_cast<model_id_t>(std::stoul(parameter)) };
+            const engine_t e { name == "isolation" ? engine_t::isolation :
+                               name == "differences" ? engine_t::differences : engine_t::calculation };
+            per_unit = e == engine_t::isolation ? &result.isolation :
+                       e == engine_t::differences ? &result.differences : &result.calculation;
+            u = plan.work(e);
+         }
+         else if (name == "write" && (parameter == "fused" || parameter == "binary"))
+         {
+            per_unit = parameter == "fused" ? &result.fl : &result.fl_binary;
+            u = capacity_plan_t { static_cast<feature_id_t>(F),complete_model }.work(engine_t::fl);
+         }
+         if (per_unit && u.fits() && u.value() > 0 && !(u < units[per_unit]))
+         {
+            units[per_unit] = u;
+            *per_unit = seconds / u.to_double();
+         }
+      }
+      return result;
+   }
 }
 
 #endif // FEATURES_H
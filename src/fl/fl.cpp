@@ -9,9 +9,41 @@
 
 #include <fstream> // because of ofstream
 #include <iostream>
-#include <vector> // because of vector<bool> and vector<>
+#include <vector> // because of vector<>
+#include <span> // because of span<>
+#include <string>
+#include <sstream> // because of istringstream
+#include <charconv> // because of to_chars()
+#include <limits> // because of numeric_limits<>
+#include <array>
+#include <algorithm> // because of fill() and min()
 #include <exception>
-#include <cstdint> // because of std::uintmax_t
+#include <cstdint> // because of std::uintmax_t and std::uint64_t
+#include <memory> // because of unique_ptr<>
+#include <functional> // because of function<>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <cstring> // because of strerror() and memcpy()
+#include <climits> // because of CHAR_BIT
+#include <bit> // because of endian
+#include <cerrno>
+#include <chrono> // because of steady_clock
+#include <ctime> // because of clock()
+#include <filesystem> // because of file_size() and remove()
+#include <random> // because of random_device
+#include <cctype> // because of isdigit()
+#include <optional>
+#include <unordered_map> // because of unordered_map<>
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h> // because of open()
+#include <unistd.h> // because of pwrite() and ftruncate()
+#include <sys/resource.h> // because of getrusage()
+#endif
+#if defined(__GNUC__) && defined(__x86_64__)
+#include <immintrin.h> // because of AVX2 and AVX-512 intrinsics
+#endif
 using namespace std;
 
 /*! checking turns some checks for errors on or off.
@@ -24,16 +56,195 @@ using namespace std;
  */
 constexpr bool checking { true }; // Initialize to false
                                   // to turn off runtime checking.
+/*! instrumenting turns the measurement of phases on or off.
+ *  Initializing instrumenting to true, writes a report with the
+ *  measurements of all phases to fl_<F>_report.json.
+ *  instrumenting should always be tested with if constexpr.
+ *  Only then, the code performing the measurements
+ *  will not be included in the object code
+ *  if instrumenting is initialized to false.
+ */
+constexpr bool instrumenting { false }; // Initialize to true
+                                        // to turn on instrumentation.
 /*! Type alias for the program specific name for the
  *  unsigned integer type to be used throughout the program.
  */
 using maxnat_t = uintmax_t;
 
+/*! Type alias for the unsigned integer type that is used for planning
+ *  and for counting the systems of symbolic expressions.
+ *  For F < 64, all counts and sizes of a run fit into 128 bits.
+ */
+using wide_t = unsigned __int128;
+
 /*! This string constant defines the prefix that is
  *  used consistently for the names of all files that are
  *  produced by the program.
  */
 const string prefix { "fl_" };
+
+/*! Exemplars of this class measure the phases of a run. The counters
+ *  are updated by all threads. The number of lines of a phase is calculated
+ *  in closed form, the number of bytes is the size of the files written by it.
+ */
+class instrumentation_t
+{
+   public:
+      /*! Measurements of a single phase.
+       */
+      struct phase_t
+      {
+         string name;
+         double wall_seconds { 0 },
+                cpu_seconds { 0 };
+         maxnat_t combinations { 0 },
+                  operations { 0 },
+                  lines { 0 },
+                  bytes { 0 };
+      };
+      /*! Adds n to the number of enumerated combinations.
+       *\param n Number of combinations.
+       */
+      void count_combinations(maxnat_t n)
+      {
+         if constexpr (instrumenting)
+         {
+            m_combinations.fetch_add(n,memory_order_relaxed);
+         }
+      }
+      /*! Adds n to the number of bitwise operations on difference expressions.
+       *\param n Number of operations.
+       */
+      void count_operations(maxnat_t n)
+      {
+         if constexpr (instrumenting)
+         {
+            m_operations.fetch_add(n,memory_order_relaxed);
+         }
+      }
+      /*! Calls work and records its measurements as a phase,
+       *  if instrumenting is true.
+       *\param name Name of the phase.
+       *\param F Number of independent features, which determines the names of the files.
+       *\param lines Number of lines or records written by work.
+       *\param categories Feature categories of the files written by work.
+       *\param extension Extension of the files written by work, for example ".csv".
+       *\param work Function that performs the phase.
+       *\returns Result of work.
+       */
+      template <class Work>
+      auto run_phase(const char* name,maxnat_t F,maxnat_t lines,
+                     initializer_list<const char*> categories,const char* extension,Work work)
+      {
+         const scope_t scope { *this,name,F,lines,categories,extension };
+         return work();
+      }
+      /*! Outputs the measurements of all phases as JSON.
+       *\param os Output stream passed as reference.
+       *\param F Number of independent features.
+       */
+      void print_json(ostream& os,maxnat_t F) const
+      {
+         os << "{\n  \"program\": \"fl\",\n  \"F\": " << F << ",\n  \"phases\": [";
+         for (maxnat_t i { 0 }; i < m_phases.size(); ++i)
+         {
+            const auto& p { m_phases[i] };
+            os << (i ? "," : "") << "\n    { \"name\": \"" << p.name
+               << "\", \"wall_seconds\": " << p.wall_seconds
+               << ", \"cpu_seconds\": " << p.cpu_seconds
+               << ", \"combinations\": " << p.combinations
+               << ", \"operations\": " << p.operations
+               << ", \"lines\": " << p.lines
+               << ", \"bytes\": " << p.bytes << " }";
+         }
+         os << "\n  ],\n  \"peak_rss_bytes\": " << peak_rss() << "\n}\n";
+      }
+      /*! Returns the peak resident set size of the process in bytes.
+       *\returns Peak resident set size, or 0 if it is not available.
+       */
+      static maxnat_t peak_rss()
+      {
+#if defined(__unix__) || defined(__APPLE__)
+         rusage usage { };
+         if (getrusage(RUSAGE_SELF,&usage) == 0)
+         {
+#if defined(__APPLE__)
+            return usage.ru_maxrss;
+#else
+            return static_cast<maxnat_t>(usage.ru_maxrss) * 1024;
+#endif
+         }
+#endif
+         return 0;
+      }
+   private:
+      /*! Records a phase from its construction until its destruction.
+       */
+      class scope_t
+      {
+         public:
+            scope_t(instrumentation_t& owner,const char* name,maxnat_t F,maxnat_t lines,
+                    initializer_list<const char*> categories,const char* extension)
+               :m_owner { owner },m_F { F },m_categories(categories),m_extension { extension }
+            {
+               if constexpr (instrumenting)
+               {
+                  m_phase.name = name;
+                  m_phase.lines = lines;
+                  m_phase.combinations = m_owner.m_combinations;
+                  m_phase.operations = m_owner.m_operations;
+                  m_wall_start = chrono::steady_clock::now();
+                  m_cpu_start = clock();
+               }
+            }
+            scope_t(const scope_t&) = delete;
+            scope_t& operator=(const scope_t&) = delete;
+            ~scope_t()
+            {
+               if constexpr (instrumenting)
+               {
+                  m_phase.wall_seconds = chrono::duration<double>(chrono::steady_clock::now() - m_wall_start).count();
+                  m_phase.cpu_seconds = static_cast<double>(clock() - m_cpu_start) / CLOCKS_PER_SEC;
+                  m_phase.combinations = m_owner.m_combinations - m_phase.combinations;
+                  m_phase.operations = m_owner.m_operations - m_phase.operations;
+                  m_phase.bytes = file_sizes(m_F,m_categories,m_extension);
+                  m_owner.m_phases.push_back(m_phase);
+               }
+            }
+         private:
+            instrumentation_t& m_owner;
+            const maxnat_t m_F;
+            const initializer_list<const char*> m_categories;
+            const char* const m_extension;
+            phase_t m_phase;
+            chrono::steady_clock::time_point m_wall_start { };
+            clock_t m_cpu_start { };
+      };
+      /*! Returns the total size of the files with the given categories for F.
+       *\param F Number of independent features.
+       *\param categories Feature categories of the files.
+       *\param extension Extension of the files, for example ".csv".
+       *\returns Number of bytes, where missing files count as 0.
+       */
+      static maxnat_t file_sizes(maxnat_t F,initializer_list<const char*> categories,const char* extension)
+      {
+         maxnat_t result { 0 };
+         for (const auto category : categories)
+         {
+            error_code ec;
+            const auto size { filesystem::file_size(prefix + to_string(F) + "_" + category + extension,ec) };
+            result += ec ? 0 : size;
+         }
+         return result;
+      }
+      atomic<maxnat_t> m_combinations { 0 },
+                       m_operations { 0 };
+      vector<phase_t> m_phases;
+};
+
+/*! Instrumentation of this run of the program.
+ */
+instrumentation_t instrumentation;
 /*! Calculates and returns the power of base and exponent.
  * \param base Value for the base of the power expression.
  * \param exponent Value for the exponent of the power expression.
@@ -63,6 +274,29 @@ maxnat_t ceil_div(const maxnat_t& x,const maxnat_t& y)
    return x / y + !!(x % y);
 }
 
+/*! Calculates and returns the binomial coefficient of n and k,
+ * that is, the number of combinations of n elements and sample size k.
+ * The intermediate products are calculated with 128 bits,
+ * so that they do not overflow before the result does.
+ *\param n Number of elements.
+ *\param k Sample size.
+ *\returns Binomial coefficient, which is 0 for k > n.
+ */
+maxnat_t binomial(maxnat_t n,maxnat_t k)
+{
+   if (k > n)
+   {
+      return 0;
+   }
+   k = min(k,n - k);
+   unsigned __int128 result { 1 };
+   for (maxnat_t i { 0 }; i < k; ++i)
+   {
+      result = result * (n - i) / (i + 1);
+   }
+   return static_cast<maxnat_t>(result);
+}
+
 /*! Type alias for the program specific name for the
  *  unsigned integer type that is used consistently
  *  for everything related to the combination_t class. 
@@ -95,6 +329,7 @@ class combination_t
             }
          }
          initialize();
+         instrumentation.count_combinations(1);
       }
       /*! Creates initial valid state for a combination_t exemplar.
        */
@@ -127,14 +362,15 @@ class combination_t
       {
          for (auto i { m_state.size() }; i > 0; --i)
          {
-            auto v { m_state.at(i - 1) };
+            auto v { m_state[i - 1] };
             if (v < m_n && v + 1 + k() - i < m_n)
             {
-              m_state.at(i - 1) += 1;
+              m_state[i - 1] += 1;
               for (auto j { i }; j < m_state.size(); ++j)
               {
-                 m_state.at(j) = m_state.at(j - 1) + 1;
+                 m_state[j] = m_state[j - 1] + 1;
               }
+              instrumentation.count_combinations(1);
               return true;
             }
          }
@@ -147,16 +383,315 @@ class combination_t
       {
         return m_state;
       }
+      /*! Returns the elements of the actual combination without copying them.
+       *  The span remains valid for the lifetime of the exemplar,
+       *  and it reflects the state after next() or unrank().
+       *\returns Span of internal state of combination.
+       */
+      span<const combination_element_t> state() const
+      {
+        return m_state;
+      }
+      /*! Returns the number of all combinations, that is, binomial(n(),k()).
+       *\returns Number of combinations.
+       */
+      maxnat_t count() const
+      {
+         return binomial(n(),k());
+      }
+      /*! Returns the position of the actual combination in the
+       *  lexicographic order in which next() generates the combinations.
+       *  It is calculated with the combinatorial number system.
+       *\returns Rank in the range [0,count()).
+       */
+      maxnat_t rank() const
+      {
+         maxnat_t result { count() - 1 };
+         for (maxnat_t i { 0 }; i < k(); ++i)
+         {
+            result -= binomial(n() - 1 - m_state[i],k() - i);
+         }
+         return result;
+      }
+      /*! Sets the actual combination to the combination with rank r,
+       *  so that the combinations can be generated from any position.
+       *  This is the inverse of rank().
+       *\param r Rank in the range [0,count()).
+       */
+      void unrank(maxnat_t r)
+      {
+         if constexpr (checking)
+         {
+            if (r >= count())
+            {
+               throw domain_error("r >= count()");
+            }
+         }
+         maxnat_t x { count() - 1 - r };
+         maxnat_t a { n() };
+         for (maxnat_t i { 0 }; i < k(); ++i)
+         {
+            do
+            {
+               --a;
+            } while (binomial(a,k() - i) > x);
+            x -= binomial(a,k() - i);
+            m_state[i] = n() - 1 - a;
+         }
+      }
    private:
       combination_element_t m_n;
       combination_element_t m_k;
       std::vector<combination_element_t> m_state;
 };
 
-/*! Type alias for the program specific name for a
- *  difference expression to be used throughout the program.
+/*! Type alias for the program specific name for the
+ *  unsigned integer type that stores 64 bits of a
+ *  difference expression.
+ */
+using word_t = uint64_t;
+
+/*! Number of bits per word_t.
+ */
+constexpr maxnat_t word_bits { 64 };
+
+/*! Function pointer types for the kernels that perform bitwise
+ *  operations on n words of difference expressions.
+ */
+using binary_kernel_t = void (*)(word_t* left,const word_t* right,maxnat_t n);
+using unary_kernel_t = void (*)(word_t* words,maxnat_t n);
+
+/*! Portable kernel for bitwise-and assignment of n words.
+ */
+void and_kernel(word_t* left,const word_t* right,maxnat_t n)
+{
+   for (maxnat_t i { 0 }; i < n; ++i)
+   {
+      left[i] &= right[i];
+   }
+}
+
+/*! Portable kernel for bitwise-or assignment of n words.
+ */
+void or_kernel(word_t* left,const word_t* right,maxnat_t n)
+{
+   for (maxnat_t i { 0 }; i < n; ++i)
+   {
+      left[i] |= right[i];
+   }
+}
+
+/*! Portable kernel for bitwise negation of n words.
+ */
+void not_kernel(word_t* words,maxnat_t n)
+{
+   for (maxnat_t i { 0 }; i < n; ++i)
+   {
+      words[i] = ~words[i];
+   }
+}
+
+#if defined(__GNUC__) && defined(__x86_64__)
+/*! The following kernels process 256 or 512 bits per step.
+ *  They are compiled for AVX2 and AVX-512 respectively by means of the
+ *  target attribute, so that no special compiler options are required.
+ *  Which kernels are actually used is decided at runtime, see kernels().
+ *  The remaining words are processed by the portable kernels.
+ */
+__attribute__((target("avx2")))
+void and_kernel_avx2(word_t* left,const word_t* right,maxnat_t n)
+{
+   maxnat_t i { 0 };
+   for (; i + 4 <= n; i += 4)
+   {
+      auto l { reinterpret_cast<__m256i*>(left + i) };
+      auto r { reinterpret_cast<const __m256i*>(right + i) };
+      _mm256_storeu_si256(l,_mm256_and_si256(_mm256_loadu_si256(l),_mm256_loadu_si256(r)));
+   }
+   and_kernel(left + i,right + i,n - i);
+}
+
+__attribute__((target("avx2")))
+void or_kernel_avx2(word_t* left,const word_t* right,maxnat_t n)
+{
+   maxnat_t i { 0 };
+   for (; i + 4 <= n; i += 4)
+   {
+      auto l { reinterpret_cast<__m256i*>(left + i) };
+      auto r { reinterpret_cast<const __m256i*>(right + i) };
+      _mm256_storeu_si256(l,_mm256_or_si256(_mm256_loadu_si256(l),_mm256_loadu_si256(r)));
+   }
+   or_kernel(left + i,right + i,n - i);
+}
+
+__attribute__((target("avx2")))
+void not_kernel_avx2(word_t* words,maxnat_t n)
+{
+   const __m256i ones { _mm256_set1_epi64x(-1) };
+   maxnat_t i { 0 };
+   for (; i + 4 <= n; i += 4)
+   {
+      auto w { reinterpret_cast<__m256i*>(words + i) };
+      _mm256_storeu_si256(w,_mm256_xor_si256(_mm256_loadu_si256(w),ones));
+   }
+   not_kernel(words + i,n - i);
+}
+
+__attribute__((target("avx512f")))
+void and_kernel_avx512(word_t* left,const word_t* right,maxnat_t n)
+{
+   maxnat_t i { 0 };
+   for (; i + 8 <= n; i += 8)
+   {
+      _mm512_storeu_si512(left + i,_mm512_and_si512(_mm512_loadu_si512(left + i),
+                                                    _mm512_loadu_si512(right + i)));
+   }
+   and_kernel(left + i,right + i,n - i);
+}
+
+__attribute__((target("avx512f")))
+void or_kernel_avx512(word_t* left,const word_t* right,maxnat_t n)
+{
+   maxnat_t i { 0 };
+   for (; i + 8 <= n; i += 8)
+   {
+      _mm512_storeu_si512(left + i,_mm512_or_si512(_mm512_loadu_si512(left + i),
+                                                   _mm512_loadu_si512(right + i)));
+   }
+   or_kernel(left + i,right + i,n - i);
+}
+
+__attribute__((target("avx512f")))
+void not_kernel_avx512(word_t* words,maxnat_t n)
+{
+   const __m512i ones { _mm512_set1_epi64(-1) };
+   maxnat_t i { 0 };
+   for (; i + 8 <= n; i += 8)
+   {
+      _mm512_storeu_si512(words + i,_mm512_xor_si512(_mm512_loadu_si512(words + i),ones));
+   }
+   not_kernel(words + i,n - i);
+}
+#endif
+
+/*! Set of kernels that is used for bitwise operations on difference expressions.
+ */
+struct kernels_t
+{
+   binary_kernel_t and_words;
+   binary_kernel_t or_words;
+   unary_kernel_t not_words;
+};
+
+/*! Returns the fastest set of kernels that is supported by the CPU.
+ *  The selection is performed only once.
+ *\returns Set of kernels as reference to const.
+ */
+const kernels_t& kernels()
+{
+   static const kernels_t k { [] () -> kernels_t
+                              {
+#if defined(__GNUC__) && defined(__x86_64__)
+                                 if (__builtin_cpu_supports("avx512f"))
+                                 {
+                                    return { and_kernel_avx512,or_kernel_avx512,not_kernel_avx512 };
+                                 }
+                                 if (__builtin_cpu_supports("avx2"))
+                                 {
+                                    return { and_kernel_avx2,or_kernel_avx2,not_kernel_avx2 };
+                                 }
+#endif
+                                 return { and_kernel,or_kernel,not_kernel };
+                              }()
+                            };
+   return k;
+}
+
+/*! Exemplars of this class represent difference expressions as bit strings.
+ *  Bit i indicates whether system i + 1 has to be intersected (1) or
+ *  to be united (0). The bits are packed into 64-bit words, least significant
+ *  word first. Unused bits of the last word are always 0.
  */
-using difference_expression_t = vector<bool>;
+class difference_expression_t
+{
+   public:
+      /*! Creates an empty difference expression.
+       */
+      difference_expression_t() = default;
+      /*! Creates a difference expression with size bits that are all 0.
+       *\param size Number of bits, that is, number of systems.
+       */
+      explicit difference_expression_t(maxnat_t size):m_size { size },
+                                                       m_words(ceil_div(size,word_bits))
+      {}
+      /*! Returns number of bits.
+       *\returns Number of bits.
+       */
+      maxnat_t size() const
+      {
+         return m_size;
+      }
+      /*! Returns number of words.
+       *\returns Number of words.
+       */
+      maxnat_t word_count() const
+      {
+         return m_words.size();
+      }
+      /*! Returns pointer to the words.
+       *\returns Pointer to the least significant word.
+       */
+      word_t* data()
+      {
+         return m_words.data();
+      }
+      /*! Returns pointer to the words.
+       *\returns Pointer to const to the least significant word.
+       */
+      const word_t* data() const
+      {
+         return m_words.data();
+      }
+      /*! Returns value of bit i.
+       *\param i Index of bit (0..size() - 1).
+       *\returns Value of bit i.
+       */
+      bool operator[](maxnat_t i) const
+      {
+         return m_words[i / word_bits] >> (i % word_bits) & 1llu;
+      }
+      /*! Sets bit i to value.
+       *\param i Index of bit (0..size() - 1).
+       *\param value New value of bit i.
+       */
+      void set(maxnat_t i,bool value)
+      {
+         const word_t mask { 1llu << (i % word_bits) };
+         if (value)
+         {
+            m_words[i / word_bits] |= mask;
+         }
+         else
+         {
+            m_words[i / word_bits] &= ~mask;
+         }
+      }
+      /*! Sets unused bits of last word to 0.
+       */
+      void trim()
+      {
+         if (m_size % word_bits)
+         {
+            m_words.back() &= (1llu << (m_size % word_bits)) - 1llu;
+         }
+      }
+      /*! Two difference expressions are equal if they have the same bits.
+       */
+      bool operator==(const difference_expression_t&) const = default;
+   private:
+      maxnat_t m_size { 0 };
+      vector<word_t> m_words;
+};
 
 /*! Calculates and returns bitwise negation of difference expression.
  *\param de Difference expression passed by value.
@@ -164,11 +699,8 @@ using difference_expression_t = vector<bool>;
  */
 difference_expression_t operator~(difference_expression_t de)
 {
-   // vector<bool> seems to lack support for range-based for loops.
-   for (maxnat_t i { 0 }; i < de.size() ; ++i)
-   {
-      de[i] = !de[i]; // The elements of vector<bool> are bool's.
-   }                  // Therefore, ! should be used for negation.
+   kernels().not_words(de.data(),de.word_count());
+   de.trim();
    return de;
 }
 
@@ -187,10 +719,7 @@ difference_expression_t& operator&=(difference_expression_t& left,
          throw length_error("left.size() != right.size()");
       }
    }
-   for (maxnat_t i { 0 }; i < left.size() ; ++i)
-   {
-      left[i] = left[i] && right[i];
-   }
+   kernels().and_words(left.data(),right.data(),left.word_count());
    return left;
 }
 
@@ -209,75 +738,389 @@ difference_expression_t& operator|=(difference_expression_t& left,
          throw length_error("left.size() != right.size()");
       }
    }
-   for (maxnat_t i { 0 }; i < left.size() ; ++i)
+   kernels().or_words(left.data(),right.data(),left.word_count());
+   return left;
+}
+
+/*! Exemplars of this class wrap a difference expression, so that
+ *  its negation is inserted into a stream without calculating it.
+ */
+struct negated_expression
+{
+   /*! Difference expression whose negation is to be inserted.
+    */
+   const difference_expression_t& de;
+};
+
+/*! Creates a table that expands each value of a byte into its
+ *  CHAR_BIT characters '0' and '1', most significant bit first.
+ *\returns Table with one entry per value of a byte.
+ */
+constexpr array<array<char,CHAR_BIT>,1 << CHAR_BIT> make_bit_table()
+{
+   array<array<char,CHAR_BIT>,1 << CHAR_BIT> table { };
+   for (maxnat_t v { 0 }; v < table.size(); ++v)
    {
-      left[i] = left[i] || right[i];
+      for (maxnat_t b { 0 }; b < CHAR_BIT; ++b)
+      {
+         table[v][b] = v >> (CHAR_BIT - 1 - b) & 1 ? '1' : '0';
+      }
    }
-   return left;
+   return table;
 }
 
-/*! Stream insertion operator for difference expressions.
- *\param os Output stream passed as reference.
+/*! Characters of each value of a byte, see make_bit_table().
+ */
+constexpr auto bit_table { make_bit_table() };
+
+/*! Appends the characters of the bits i - CHAR_BIT..i - 1 of a word
+ *  to p, most significant bit first.
+ *\param p Pointer to CHAR_BIT characters.
+ *\param value Word that contains the bits.
+ *\param i Index of the bit after the byte, which is a multiple of CHAR_BIT (CHAR_BIT..word_bits).
+ */
+inline void expand_byte(char* p,word_t value,maxnat_t i)
+{
+   memcpy(p,bit_table[value >> (i - CHAR_BIT) & ((1u << CHAR_BIT) - 1u)].data(),CHAR_BIT);
+}
+
+/*! Appends the bits of a difference expression to a string,
+ *  most significant bit first. The bits below the most significant
+ *  multiple of CHAR_BIT are expanded byte by byte with bit_table.
+ *\param buffer String passed as reference.
  *\param de Difference expression passed as reference to const.
- *\returns Output stream as reference.
+ *\param negated True if the negated bits are to be appended.
  */
-ostream& operator<<(ostream& os,const difference_expression_t& de)
+void append_bits(string& buffer,const difference_expression_t& de,bool negated)
 {
-   for (maxnat_t i { de.size() }; i > 0; --i)
+   const maxnat_t start { buffer.size() };
+   buffer.resize(start + de.size());
+   char* p { buffer.data() + start };
+   maxnat_t i { de.size() };
+   for (; i % CHAR_BIT; --i)
+   {
+      *p++ = de[i - 1] != negated ? '1' : '0';
+   }
+   const word_t mask { negated ? ~0llu : 0llu };
+   for (; i > 0; i -= CHAR_BIT, p += CHAR_BIT)
    {
-      os << de[i - 1];
+      expand_byte(p,de.data()[(i - 1) / word_bits] ^ mask,(i - 1) % word_bits + 1);
    }
-   return os;
 }
 
-/*! Exemplars of this class allow to systematically generate
- *  all difference expressions for isolating independent features
- *  for given number F of independent features.
+/*! Appends a natural number in decimal notation to a string.
+ *\param buffer String passed as reference.
+ *\param n Natural number.
  */
-class difference_expression_generator
+void append_number(string& buffer,maxnat_t n)
 {
-   public:
-      /*! A difference expression exemplar must be initialized with 
-       *  the number of independent features.
-       *\param F Number of independent features.
-       */
-      explicit difference_expression_generator(const maxnat_t F):m_F { F },
-                                                                 m_S { power(2,F) }
-      {}
-      /*! Calculates and returns difference expression for given feature.
-       *\param f Feature-id (1..F)
-       *\returns Difference expression as value.
-       */
-      difference_expression_t operator()(maxnat_t f) const
+   array<char,numeric_limits<maxnat_t>::digits10 + 1> digits;
+   const auto [end,error] { to_chars(digits.data(),digits.data() + digits.size(),n) };
+   buffer.append(digits.data(),end);
+}
+
+/*! Appends the words of a difference expression to a string
+ *  as they are stored in memory, least significant word first.
+ *\param buffer String passed as reference.
+ *\param de Difference expression passed as reference to const.
+ *\param negated True if the negated words are to be appended.
+ */
+void append_words(string& buffer,const difference_expression_t& de,bool negated)
+{
+   const maxnat_t start { buffer.size() };
+   buffer.resize(start + de.word_count() * sizeof(word_t));
+   char* p { buffer.data() + start };
+   for (maxnat_t w { 0 }; w < de.word_count(); ++w)
+   {
+      word_t value { negated ? ~de.data()[w] : de.data()[w] };
+      if (w + 1 == de.word_count() && de.size() % word_bits)
       {
-         if constexpr (checking)
-         {
-            if (f > F())
-            {
-               throw invalid_argument("f > F()");
-            }
-         }
-         difference_expression_t bitstring { };
-         bitstring.reserve(S());
-         maxnat_t counter { 0 };
-         bool bit { false };
-         maxnat_t stride { power(2,f - 1) };
-         for (maxnat_t system { 0 }; system < S(); ++system)
-         {
-            bitstring.push_back(bit);
-            ++counter;
-            if (counter == stride)
-            {
-               bit = !bit;
-               counter = 0;
-            }
-         }
-         return bitstring;
+         value &= (1llu << (de.size() % word_bits)) - 1llu;
       }
-      /*! Calculates and returns value for given feature and system.
-       * Important: The implementation calculates this value arithmetically.
-       * It does not create a difference expression.
-       * Therefore, it requires only minimal memory.
+      memcpy(p + w * sizeof(word_t),&value,sizeof(word_t));
+   }
+}
+
+/*! Tag of a record of the compressed variant of the binary format
+ *  whose words are stored unchanged.
+ */
+constexpr char raw_record { 0 };
+
+/*! Tag of a record of the compressed variant of the binary format
+ *  whose words are stored as runs.
+ */
+constexpr char run_record { 1 };
+
+/*! Appends a natural number to a string as variable-length number,
+ *  seven bits per byte, least significant first. The high bit of
+ *  a byte is set if another byte follows.
+ *\param buffer String passed as reference.
+ *\param n Natural number.
+ */
+void append_varint(string& buffer,maxnat_t n)
+{
+   for (; n >= 0x80; n >>= 7)
+   {
+      buffer += static_cast<char>((n & 0x7F) | 0x80);
+   }
+   buffer += static_cast<char>(n);
+}
+
+/*! Appends the words of a difference expression to a string as record of
+ *  the compressed variant of the binary format, see features::append_compressed().
+ *  A record starts with its tag. A run_record consists of runs, each of which
+ *  is a variable-length number of repetitions followed by the repeated word.
+ *  If the runs require more space than the words, the words are appended
+ *  unchanged in a raw_record.
+ *\param buffer String passed as reference.
+ *\param de Difference expression passed as reference to const.
+ *\param negated True if the negated words are to be appended.
+ */
+void append_compressed(string& buffer,const difference_expression_t& de,bool negated)
+{
+   const maxnat_t start { buffer.size() },
+                  limit { start + 1 + de.word_count() * sizeof(word_t) };
+   // Returns word w of the result, whose bits that exceed size() are 0.
+   auto word { [&] (maxnat_t w)
+               {
+                  word_t value { negated ? ~de.data()[w] : de.data()[w] };
+                  if (w + 1 == de.word_count() && de.size() % word_bits)
+                  {
+                     value &= (1llu << (de.size() % word_bits)) - 1llu;
+                  }
+                  return value;
+               }
+             };
+   buffer += run_record;
+   for (maxnat_t w { 0 }; w < de.word_count() && buffer.size() <= limit; )
+   {
+      const word_t value { word(w) };
+      maxnat_t n { 1 };
+      while (w + n < de.word_count() && word(w + n) == value)
+      {
+         ++n;
+      }
+      append_varint(buffer,n);
+      buffer.append(reinterpret_cast<const char*>(&value),sizeof(value));
+      w += n;
+   }
+   if (buffer.size() > limit)
+   {
+      buffer.resize(start);
+      buffer += raw_record;
+      append_words(buffer,de,negated);
+   }
+}
+
+/*! Inserts the bits of a difference expression into a stream.
+ *  The bits are collected in a string, which is inserted at once.
+ *\param os Output stream passed as reference.
+ *\param de Difference expression passed as reference to const.
+ *\param negated True if the negated bits are to be inserted.
+ *\returns Output stream as reference.
+ */
+ostream& insert_bits(ostream& os,const difference_expression_t& de,bool negated)
+{
+   string bits;
+   append_bits(bits,de,negated);
+   return os << bits;
+}
+
+/*! Stream insertion operator for difference expressions.
+ *\param os Output stream passed as reference.
+ *\param de Difference expression passed as reference to const.
+ *\returns Output stream as reference.
+ */
+ostream& operator<<(ostream& os,const difference_expression_t& de)
+{
+   return insert_bits(os,de,false);
+}
+
+/*! Stream insertion operator for negated difference expressions.
+ *\param os Output stream passed as reference.
+ *\param n Wrapped difference expression passed as reference to const.
+ *\returns Output stream as reference.
+ */
+ostream& operator<<(ostream& os,const negated_expression& n)
+{
+   return insert_bits(os,n.de,true);
+}
+
+/*! Words of the difference expressions of the independent features
+ *  f = 1..6, whose strides 2^(f - 1) are smaller than word_bits.
+ *  Index 0 is unused.
+ */
+constexpr array<word_t,7> pattern_words { 0x0000000000000000llu,
+                                          0xAAAAAAAAAAAAAAAAllu,
+                                          0xCCCCCCCCCCCCCCCCllu,
+                                          0xF0F0F0F0F0F0F0F0llu,
+                                          0xFF00FF00FF00FF00llu,
+                                          0xFFFF0000FFFF0000llu,
+                                          0xFFFFFFFF00000000llu };
+
+/*! Determines how a difference expression for F - 1 independent features
+ *  is extended to F independent features. Systems 1..S/2 lack the new
+ *  feature f_F, systems S/2 + 1..S have it.
+ */
+enum class extension_t
+{
+   /*! The combination does not contain f_F, so both halves equal the previous expression.
+    */
+   repeated,
+   /*! The previous expression is combined with f_F by and.
+    */
+   conjunction,
+   /*! The previous expression is combined with f_F by or.
+    */
+   disjunction
+};
+
+/*! Exemplars of this class allow to systematically generate
+ *  all difference expressions for isolating independent features
+ *  for given number F of independent features.
+ */
+class difference_expression_generator
+{
+   public:
+      /*! A difference expression exemplar must be initialized with 
+       *  the number of independent features.
+       *\param F Number of independent features.
+       */
+      explicit difference_expression_generator(const maxnat_t F):m_F { F },
+                                                                 m_S { power(2,F) }
+      {}
+      /*! Calculates and returns difference expression for given feature.
+       * The difference expression is filled word by word.
+       * For f <= 6 each word equals pattern_words[f].
+       * For f > 6 the words form alternating runs of 2^(f - 7)
+       * words that are either all 0 or all 1.
+       *\param f Feature-id (1..F)
+       *\returns Difference expression as value.
+       */
+      difference_expression_t operator()(maxnat_t f) const
+      {
+         if constexpr (checking)
+         {
+            if (f > F())
+            {
+               throw invalid_argument("f > F()");
+            }
+         }
+         difference_expression_t bitstring(S());
+         word_t* words { bitstring.data() };
+         const maxnat_t n { bitstring.word_count() };
+         if (f < pattern_words.size())
+         {
+            fill(words,words + n,pattern_words[f]);
+         }
+         else
+         {
+            const maxnat_t run { power(2,f - 7) };
+            for (maxnat_t w { run }; w < n; w += 2 * run)
+            {
+               fill(words + w,words + min(w + run,n),~word_t { 0 });
+            }
+         }
+         bitstring.trim();
+         return bitstring;
+      }
+      /*! Returns word w of the difference expression for given feature
+       *  without creating the difference expression.
+       *\param f Feature-id (1..F)
+       *\param w Index of word (0..ceil_div(S(),word_bits) - 1)
+       *\returns Word w, with bits that exceed S() set to 0.
+       */
+      word_t word(maxnat_t f,maxnat_t w) const
+      {
+         word_t result { f < pattern_words.size() ? pattern_words[f]
+                                                  : (w >> (f - 7) & 1llu ? ~word_t { 0 } : 0) };
+         if (S() < word_bits)
+         {
+            result &= (1llu << S()) - 1llu;
+         }
+         return result;
+      }
+      /*! Extends a difference expression for F - 1 independent features
+       *  to F independent features, whereby its width is doubled.
+       *\param previous Difference expression for F - 1 independent features.
+       *\param extension Determines how the new feature f_F is included.
+       *\returns Difference expression as value.
+       */
+      difference_expression_t extend(const difference_expression_t& previous,extension_t extension) const
+      {
+         if constexpr (checking)
+         {
+            if (2 * previous.size() != S())
+            {
+               throw invalid_argument("2 * previous.size() != S()");
+            }
+         }
+         difference_expression_t result(S());
+         word_t* words { result.data() };
+         const word_t* low { previous.data() };
+         const maxnat_t half { previous.size() };
+         if (half >= word_bits)
+         {
+            // Both halves consist of whole words.
+            const maxnat_t n { previous.word_count() };
+            if (extension == extension_t::conjunction)
+            {
+               fill(words,words + n,word_t { 0 });
+            }
+            else
+            {
+               copy(low,low + n,words);
+            }
+            if (extension == extension_t::disjunction)
+            {
+               fill(words + n,words + 2 * n,~word_t { 0 });
+            }
+            else
+            {
+               copy(low,low + n,words + n);
+            }
+         }
+         else
+         {
+            const word_t high { extension == extension_t::disjunction ? (1llu << half) - 1llu : low[0] };
+            words[0] = (extension == extension_t::conjunction ? 0 : low[0]) | high << half;
+         }
+         return result;
+      }
+      /*! Calculates and returns difference expression for given feature
+       *  bit by bit. This is the reference implementation for operator()(f).
+       *\param f Feature-id (1..F)
+       *\returns Difference expression as value.
+       */
+      difference_expression_t bitwise(maxnat_t f) const
+      {
+         if constexpr (checking)
+         {
+            if (f > F())
+            {
+               throw invalid_argument("f > F()");
+            }
+         }
+         difference_expression_t bitstring(S());
+         maxnat_t counter { 0 };
+         bool bit { false };
+         maxnat_t stride { power(2,f - 1) };
+         for (maxnat_t system { 0 }; system < S(); ++system)
+         {
+            bitstring.set(system,bit);
+            ++counter;
+            if (counter == stride)
+            {
+               bit = !bit;
+               counter = 0;
+            }
+         }
+         return bitstring;
+      }
+      /*! Calculates and returns value for given feature and system.
+       * Important: The implementation calculates this value arithmetically.
+       * It does not create a difference expression.
+       * Therefore, it requires only minimal memory.
        *\param f Feature-id (1..F)
        *\param s System-id (1..S)
        *\returns True if s is to be intersected (I-part) and false if it is to be united (U-part) in corresponding difference expression.
@@ -317,175 +1160,3447 @@ class difference_expression_generator
       const maxnat_t m_S;
 };
 
-/*! Outputs difference expressions for independent features to a file.
- * This implementation creates and uses difference expressions.
- *\param dg Difference generator to be used for generating difference expressions.
- */
-void print_independent_features(const difference_expression_generator& dg)
-{
-   ofstream os { prefix + to_string(dg.F()) + "_F.csv" };
-
-   for (maxnat_t f { 1 };f <= dg.F(); ++f)
-   {
-      os << 'f' << f << '\t' << dg(f) << endl;
-   }
-}
-
-/*! Outputs difference expressions for independent features to a file.
- * This implementation does neither create nor uses difference expressions!
- * Instead, the value that indicates if a system is to be intersected or to be
- * united is calculated for each individual system.
- * Therefore, this function has minimal memory requirements.
- * In general, it is possible to provide corresponding implementations
- * for all other following functions whose names begin with print_.
- *\param dg Difference generator to be used for generating difference expressions.
+/*! Exemplars of this class store the difference expressions of all
+ *  independent features and their negations, so that they are generated
+ *  only once.
  */
-void print_independent_features_alt(const difference_expression_generator& dg)
+class pattern_cache
 {
-   ofstream os { prefix + to_string(dg.F()) + "_F.csv" };
-
-   for (maxnat_t f { 1 };f <= dg.F(); ++f)
-   {
-      os << 'f' << f << '\t';
-      for (maxnat_t s { dg.S() }; s > 1; --s)
+   public:
+      /*! A pattern cache exemplar must be initialized with a
+       *  difference expression generator.
+       *\param dg Difference generator to be used for generating difference expressions.
+       */
+      explicit pattern_cache(const difference_expression_generator& dg)
       {
-         os << dg(f,s);
+         m_patterns.reserve(dg.F());
+         m_negated_patterns.reserve(dg.F());
+         for (maxnat_t f { 1 }; f <= dg.F(); ++f)
+         {
+            m_patterns.push_back(dg(f));
+            m_negated_patterns.push_back(~m_patterns.back());
+         }
       }
-      os << endl;
-   }
-}
+      /*! Returns difference expression for given feature.
+       *\param f Feature-id (1..F)
+       *\returns Difference expression as reference to const.
+       */
+      const difference_expression_t& operator()(maxnat_t f) const
+      {
+         return m_patterns.at(f - 1);
+      }
+      /*! Returns negated difference expression for given feature.
+       *\param f Feature-id (1..F)
+       *\returns Negated difference expression as reference to const.
+       */
+      const difference_expression_t& negated(maxnat_t f) const
+      {
+         return m_negated_patterns.at(f - 1);
+      }
+   private:
+      vector<difference_expression_t> m_patterns;
+      vector<difference_expression_t> m_negated_patterns;
+};
 
-/*! Outputs difference expressions for not features to a file.
- * This implementation creates and uses difference expressions.
- *\param dg Difference generator to be used for generating difference expressions.
+/*! Determines how the terms of a combination are combined.
  */
-void print_not_features(const difference_expression_generator& dg)
-{
-   ofstream os {prefix + to_string(dg.F()) + "_N.csv" };
-
-   for (maxnat_t f { 1 };f <= dg.F(); ++f)
-   {
-      os << "!f" << f << '\t' << ~dg(f) << endl;
-   }
-}
+enum class operation_t { conjunction, disjunction };
 
-/*! Outputs difference expressions for and features to a file.
- * This implementation creates and uses difference expressions.
- *\param dg Difference generator to be used for generating difference expressions.
+/*! Exemplars of this class evaluate the difference expressions of
+ *  combinations of (possibly negated) independent features.
+ *  The partial result of each prefix of the last combination is kept.
+ *  Consecutive combinations that are generated by combination_t share
+ *  a prefix, whose partial results are reused. Only the partial results
+ *  for the changed suffix are recalculated. On average, this requires
+ *  about one bitwise operation per combination instead of k - 1.
  */
-void print_and_features(const difference_expression_generator& dg)
+class combination_evaluator
 {
-   ofstream os { prefix + to_string(dg.F()) + "_A.csv" };
-
-   for (maxnat_t f { 2 }; f <= dg.F(); ++f)
-   {
-      combination_t c(dg.F(),f);
-      do
+   public:
+      /*! A combination evaluator exemplar must be initialized with a pattern cache,
+       *  the operation, and whether the independent features are negated.
+       *\param patterns Pattern cache that provides the terms.
+       *\param operation Operation that combines the terms.
+       *\param negated True if the terms are the negated independent features.
+       */
+      combination_evaluator(const pattern_cache& patterns,operation_t operation,bool negated)
+         :m_patterns { patterns },m_operation { operation },m_negated { negated }
+      {}
+      /*! Calculates and returns difference expression for a combination.
+       *\param features Combination of zero-based feature-ids as provided by combination_t.
+       *\returns Difference expression as reference to const, which remains valid until the next call.
+       */
+      const difference_expression_t& operator()(span<const combination_element_t> features)
       {
-         auto features { c() };
-         auto result { dg(features.at(0) + 1) };
-         string i { "f"s + to_string(features.at(0) + 1) };
-         for (maxnat_t e { 1 }; e < features.size(); ++ e)
+         if constexpr (checking)
          {
-            result &= dg(features.at(e) + 1);
-            i += ("*f"s + to_string(features.at(e) + 1));
+            if (features.empty())
+            {
+               throw invalid_argument("features.empty()");
+            }
          }
-         os << i << '\t' << result << endl;
-      } while (c.next());
-   }
-}
-
-/*! Outputs difference expressions for or features to a file.
- * This implementation creates and uses difference expressions.
- *\param dg Difference generator to be used for generating difference expressions.
- */
-void print_or_features(const difference_expression_generator& dg)
-{
-   ofstream os { prefix + to_string(dg.F()) + "_O.csv" };
-
-   for (maxnat_t f { 2 }; f <= dg.F(); ++f)
-   {
-      combination_t c(dg.F(),f);
-      do
-      {
-         auto features { c() };
-         auto result { dg(features.at(0) + 1) };
-         string i { "f"s + to_string(features.at(0) + 1) };
-         for (maxnat_t e { 1 }; e < features.size(); ++ e)
+         maxnat_t valid { 0 };
+         while (valid < features.size() && valid < m_features.size() &&
+                features[valid] == m_features[valid])
          {
-            result |= dg(features.at(e) + 1);
-            i += ("+f"s + to_string(features.at(e) + 1));
+            ++valid;
          }
-         os << i << '\t' << result << endl;
-      } while (c.next());
-   }
-}
+         m_features.assign(features.begin(),features.end());
+         instrumentation.count_operations(features.size() - max<maxnat_t>(valid,1));
+         if (m_partials.size() < features.size())
+         {
+            m_partials.resize(features.size());
+         }
+         for (maxnat_t i { valid }; i < features.size(); ++i)
+         {
+            const auto& term { m_negated ? m_patterns.negated(features[i] + 1)
+                                         : m_patterns(features[i] + 1) };
+            if (i == 0)
+            {
+               m_partials[i] = term;
+            }
+            else
+            {
+               m_partials[i] = m_partials[i - 1];
+               if (m_operation == operation_t::conjunction)
+               {
+                  m_partials[i] &= term;
+               }
+               else
+               {
+                  m_partials[i] |= term;
+               }
+            }
+         }
+         return m_partials[features.size() - 1];
+      }
+   private:
+      const pattern_cache& m_patterns;
+      const operation_t m_operation;
+      const bool m_negated;
+      vector<combination_element_t> m_features;
+      vector<difference_expression_t> m_partials;
+};
 
-/*! Outputs difference expressions for and-not features to a file.
- * This implementation creates and uses difference expressions.
- *\param dg Difference generator to be used for generating difference expressions.
+/*! Exemplars of this class represent difference expressions of F independent
+ *  features symbolically as reduced ordered binary decision diagrams (BDDs),
+ *  so that F is not limited by the memory for S = 2^F bits.
+ *  According to the stride rule of difference_expression_generator, bit i
+ *  of the difference expression of independent feature f is bit f - 1 of i.
+ *  Thus, each difference expression is a Boolean function of the F bits of i,
+ *  which the nodes of its BDD decide from bit F - 1 down to bit 0.
+ *  The nodes are unique and shared by all expressions, so that a conjunction
+ *  or disjunction of k (possibly negated) independent features consists of k nodes.
+ *  An expression is identified by its root node. Nodes are never freed.
+ *  A generator must not be used by several threads at the same time.
  */
-void print_and_not_features(const difference_expression_generator& dg)
+class symbolic_expression_generator
 {
-   ofstream os { prefix + to_string(dg.F()) + "_AN.csv" };
-
-   for (maxnat_t f { 2 }; f <= dg.F(); ++f)
-   {
-      combination_t c(dg.F(),f);
-      do
+   public:
+      /*! Identifies a node. The nodes 0 and 1 are the constant expressions
+       *  in which all bits are 0 and 1, respectively.
+       */
+      using node_t = uint32_t;
+      /*! A symbolic expression generator exemplar must be initialized with
+       *  the number of independent features.
+       *\param F Number of independent features (0..64).
+       */
+      explicit symbolic_expression_generator(maxnat_t F):m_F { F },m_unique(F + 1)
       {
-         auto features { c() };
-         auto result { ~dg(features.at(0) + 1) };
-         string i { "!f"s + to_string(features.at(0) + 1) };
-         for (maxnat_t e { 1 }; e < features.size(); ++ e)
+         if (F > word_bits)
          {
-            result &= ~dg(features.at(e) + 1);
-            i += ("*!f"s + to_string(features.at(e) + 1));
+            throw invalid_argument("F > 64");
          }
-         os << i << '\t' << result << endl;
-      } while (c.next());
+         m_nodes.push_back({ 0,0,0 });
+         m_nodes.push_back({ 0,1,1 });
+      }
+      /*! Returns expression of an independent feature.
+       *\param f Feature-id (1..F)
+       *\returns Root node of expression.
+       */
+      node_t operator()(maxnat_t f)
+      {
+         if constexpr (checking)
+         {
+            if (f == 0 || f > F())
+            {
+               throw invalid_argument("f == 0 || f > F()");
+            }
+         }
+         return make(f,0,1);
+      }
+      /*! Calculates and returns conjunction or disjunction of two expressions.
+       *\param operation Operation.
+       *\param a Root node of first expression.
+       *\param b Root node of second expression.
+       *\returns Root node of result.
+       */
+      node_t apply(operation_t operation,node_t a,node_t b)
+      {
+         const node_t absorbing { operation == operation_t::conjunction ? 0u : 1u };
+         if (a == absorbing || b == absorbing)
+         {
+            return absorbing;
+         }
+         if (a == 1 - absorbing || a == b)
+         {
+            return b;
+         }
+         if (b == 1 - absorbing)
+         {
+            return a;
+         }
+         if (a > b)
+         {
+            swap(a,b);
+         }
+         auto& computed { m_computed[static_cast<maxnat_t>(operation)] };
+         const uint64_t key { uint64_t { a } << 32 | b };
+         if (const auto i { computed.find(key) }; i != computed.end())
+         {
+            return i->second;
+         }
+         instrumentation.count_operations(1);
+         const auto f { max(m_nodes[a].f,m_nodes[b].f) };
+         const auto [a_low,a_high] { cofactors(a,f) };
+         const auto [b_low,b_high] { cofactors(b,f) };
+         const node_t low { apply(operation,a_low,b_low) },
+                      high { apply(operation,a_high,b_high) },
+                      result { make(f,low,high) };
+         computed.emplace(key,result);
+         return result;
+      }
+      /*! Calculates and returns negation of an expression.
+       *\param a Root node of expression.
+       *\returns Root node of result.
+       */
+      node_t negation(node_t a)
+      {
+         if (a <= 1)
+         {
+            return 1 - a;
+         }
+         if (const auto i { m_negated.find(a) }; i != m_negated.end())
+         {
+            return i->second;
+         }
+         instrumentation.count_operations(1);
+         const auto [f,low,high] { m_nodes[a] };
+         const node_t negated_low { negation(low) },
+                      negated_high { negation(high) },
+                      result { make(f,negated_low,negated_high) };
+         m_negated.emplace(a,result);
+         m_negated.emplace(result,a);
+         return result;
+      }
+      /*! Returns value of bit i of an expression without expanding it.
+       *\param a Root node of expression.
+       *\param i Index of bit, that is, system i + 1.
+       *\returns True if system i + 1 is to be intersected and false if it is to be united.
+       */
+      bool value(node_t a,maxnat_t i) const
+      {
+         while (a > 1)
+         {
+            const auto& n { m_nodes[a] };
+            a = i >> (n.f - 1) & 1llu ? n.high : n.low;
+         }
+         return a == 1;
+      }
+      /*! Returns number of bits of an expression that are 1 without expanding it.
+       *\param a Root node of expression.
+       *\returns Number of systems to be intersected, which is at most 2^F.
+       */
+      wide_t count(node_t a) const
+      {
+         unordered_map<node_t,wide_t> counts;
+         return count(a,counts) << (m_F - m_nodes[a].f);
+      }
+      /*! Calculates and returns an expression as bit string.
+       *\param a Root node of expression.
+       *\returns Difference expression with S bits as value.
+       */
+      difference_expression_t expand(node_t a) const
+      {
+         if (m_F >= word_bits)
+         {
+            throw length_error("F is too large for expanding an expression.");
+         }
+         difference_expression_t result(power(2,m_F));
+         if (m_F <= 6)
+         {
+            result.data()[0] = word(a,m_F);
+         }
+         else
+         {
+            expand(a,m_F,result.data());
+         }
+         return result;
+      }
+      /*! Returns number of independent features.
+       *\returns Number of independent features F.
+       */
+      maxnat_t F() const
+      {
+         return m_F;
+      }
+      /*! Returns number of nodes of all expressions including the constants.
+       *\returns Number of nodes.
+       */
+      maxnat_t size() const
+      {
+         return m_nodes.size();
+      }
+   private:
+      /*! Node that decides bit f - 1 of i. For the constants, f is 0.
+       */
+      struct node_data_t
+      {
+         maxnat_t f;
+         node_t low,
+                high;
+      };
+      /*! Returns unique node that decides bit f - 1 of i.
+       *\param f Feature-id (1..F)
+       *\param low Root node of expression if bit f - 1 is 0.
+       *\param high Root node of expression if bit f - 1 is 1.
+       *\returns Node, which is low if low equals high.
+       */
+      node_t make(maxnat_t f,node_t low,node_t high)
+      {
+         if (low == high)
+         {
+            return low;
+         }
+         auto& unique { m_unique[f] };
+         const uint64_t key { uint64_t { low } << 32 | high };
+         if (const auto i { unique.find(key) }; i != unique.end())
+         {
+            return i->second;
+         }
+         if (m_nodes.size() > numeric_limits<node_t>::max())
+         {
+            throw length_error("Too many nodes.");
+         }
+         const auto result { static_cast<node_t>(m_nodes.size()) };
+         m_nodes.push_back({ f,low,high });
+         unique.emplace(key,result);
+         return result;
+      }
+      /*! Returns the expressions of a for bit f - 1 of i being 0 and 1.
+       *\param a Root node of expression, which decides bit f - 1 or a lower bit.
+       *\param f Feature-id (1..F)
+       *\returns Pair of root nodes.
+       */
+      pair<node_t,node_t> cofactors(node_t a,maxnat_t f) const
+      {
+         const auto& n { m_nodes[a] };
+         return n.f == f ? pair { n.low,n.high } : pair { a,a };
+      }
+      /*! Returns number of values of bits 0..f - 1 of i for which the expression is true,
+       *  where f belongs to the root node.
+       *\param a Root node of expression.
+       *\param counts Counts of the nodes that have been visited, passed as reference.
+       *\returns Number of values.
+       */
+      wide_t count(node_t a,unordered_map<node_t,wide_t>& counts) const
+      {
+         if (a <= 1)
+         {
+            return a;
+         }
+         if (const auto i { counts.find(a) }; i != counts.end())
+         {
+            return i->second;
+         }
+         const auto [f,low,high] { m_nodes[a] };
+         const wide_t result { (count(low,counts) << (f - 1 - m_nodes[low].f)) +
+                               (count(high,counts) << (f - 1 - m_nodes[high].f)) };
+         counts.emplace(a,result);
+         return result;
+      }
+      /*! Returns the 2^level bits of an expression for which bits level..F - 1 of i are 0.
+       *\param a Root node of expression, which decides bit level - 1 or a lower bit.
+       *\param level Number of bits (0..6).
+       *\returns Bits as word.
+       */
+      word_t word(node_t a,maxnat_t level) const
+      {
+         if (a <= 1)
+         {
+            return a == 0 ? 0 : level == 6 ? ~word_t { 0 } : (1llu << (1llu << level)) - 1llu;
+         }
+         const auto& n { m_nodes[a] };
+         const maxnat_t half { 1llu << (level - 1) };
+         if (n.f < level)
+         {
+            const word_t w { word(a,level - 1) };
+            return w | w << half;
+         }
+         return word(n.low,level - 1) | word(n.high,level - 1) << half;
+      }
+      /*! Writes the 2^level bits of an expression for which bits level..F - 1 of i are 0.
+       *  Repeated halves are copied instead of being calculated again.
+       *\param a Root node of expression, which decides bit level - 1 or a lower bit.
+       *\param level Number of bits (6..F).
+       *\param words Words that receive the bits.
+       */
+      void expand(node_t a,maxnat_t level,word_t* words) const
+      {
+         const maxnat_t n { 1llu << (level - 6) };
+         if (a <= 1)
+         {
+            fill(words,words + n,a == 0 ? 0 : ~word_t { 0 });
+         }
+         else if (level == 6)
+         {
+            words[0] = word(a,6);
+         }
+         else if (m_nodes[a].f < level)
+         {
+            expand(a,level - 1,words);
+            copy(words,words + n / 2,words + n / 2);
+         }
+         else
+         {
+            expand(m_nodes[a].low,level - 1,words);
+            expand(m_nodes[a].high,level - 1,words + n / 2);
+         }
+      }
+      const maxnat_t m_F;
+      vector<node_data_t> m_nodes;
+      vector<unordered_map<uint64_t,node_t>> m_unique;
+      array<unordered_map<uint64_t,node_t>,2> m_computed;
+      unordered_map<node_t,node_t> m_negated;
+};
+
+/*! Exemplars of this class build the names of combinations of
+ *  (possibly negated) independent features, such as f1*f2*f4.
+ *  Like combination_evaluator, the name of the last combination is kept.
+ *  Consecutive combinations that are generated by combination_t share
+ *  a prefix, whose terms are reused. Only the terms of the changed suffix
+ *  are rewritten.
+ */
+class name_buffer
+{
+   public:
+      /*! A name buffer exemplar must be initialized with the operator
+       *  and whether the independent features are negated.
+       *\param op Operator between the terms, '*' or '+'.
+       *\param negated True if the terms are the negated independent features.
+       */
+      name_buffer(char op,bool negated)
+         :m_op { op },m_negated { negated }
+      {}
+      /*! Builds and returns the name of a combination.
+       *\param features Combination of zero-based feature-ids as provided by combination_t.
+       *\returns Name as reference to const, which remains valid until the next call.
+       */
+      const string& operator()(span<const combination_element_t> features)
+      {
+         maxnat_t valid { 0 };
+         while (valid < features.size() && valid < m_features.size() &&
+                features[valid] == m_features[valid])
+         {
+            ++valid;
+         }
+         m_features.assign(features.begin(),features.end());
+         m_ends.resize(features.size());
+         m_name.resize(valid > 0 ? m_ends[valid - 1] : 0);
+         for (maxnat_t i { valid }; i < features.size(); ++i)
+         {
+            if (i > 0)
+            {
+               m_name += m_op;
+            }
+            if (m_negated)
+            {
+               m_name += '!';
+            }
+            m_name += 'f';
+            append_number(m_name,features[i] + 1);
+            m_ends[i] = m_name.size();
+         }
+         return m_name;
+      }
+   private:
+      const char m_op;
+      const bool m_negated;
+      vector<combination_element_t> m_features;
+      vector<maxnat_t> m_ends;
+      string m_name;
+};
+
+/*! Writes a line that consists of a name, a tab, and the bits of a difference expression.
+ *  The line is built in a buffer, which is written at once.
+ *\param os Output stream passed as reference.
+ *\param line Buffer passed as reference, whose capacity is reused by the next line.
+ *\param name Name of the feature passed as reference to const.
+ *\param de Difference expression passed as reference to const.
+ *\param negated True if the negated bits are to be written.
+ */
+void write_line(ostream& os,string& line,const string& name,const difference_expression_t& de,bool negated)
+{
+   line = name;
+   line += '\t';
+   append_bits(line,de,negated);
+   line += '\n';
+   os.write(line.data(),line.size());
+}
+
+/*! Size of a block of an async_streambuf in bytes.
+ */
+constexpr maxnat_t async_block_size { 1llu << 20 };
+
+/*! Number of blocks of an async_streambuf.
+ */
+constexpr maxnat_t async_blocks { 4 };
+
+/*! Exemplars of this class are stream buffers that pass their output
+ *  block by block to a writer thread, which writes the blocks to a target
+ *  stream buffer, for example of a file, a pipe, or cout. Thus, calculating
+ *  the output and writing it overlap. The blocks are exchanged through a
+ *  bounded ring with a single producer and a single consumer that uses
+ *  atomic counters instead of locks. If all blocks are in flight, the
+ *  producer waits until the writer has written one, so the required memory
+ *  is bounded by the number of blocks times their size.
+ */
+class async_streambuf : public streambuf
+{
+   public:
+      /*! An async stream buffer exemplar must be initialized with its target.
+       *\param target Stream buffer to which the blocks are written.
+       *\param block_size Size of a block in bytes.
+       *\param blocks Number of blocks of the ring, at least 2.
+       */
+      explicit async_streambuf(streambuf* target,maxnat_t block_size = async_block_size,
+                               maxnat_t blocks = async_blocks)
+         :m_target { target },
+          m_blocks(max<maxnat_t>(blocks,2),string(max<maxnat_t>(block_size,1),'\0')),
+          m_sizes(m_blocks.size()),
+          m_writer { [this] { run(); } }
+      {
+         expose(0);
+      }
+      async_streambuf(const async_streambuf&) = delete;
+      async_streambuf& operator=(const async_streambuf&) = delete;
+      /*! Writes the remaining output and stops the writer thread.
+       */
+      ~async_streambuf()
+      {
+         finish();
+      }
+      /*! Writes the remaining output, stops the writer thread, and flushes the target.
+       *  Afterwards, further output fails.
+       *\returns True if all output has been written.
+       */
+      bool finish()
+      {
+         if (!m_writer.joinable())
+         {
+            return !m_failed;
+         }
+         submit();
+         const maxnat_t tail { m_tail.load(memory_order_relaxed) };
+         m_sizes[tail % m_blocks.size()] = end_of_output;
+         m_tail.store(tail + 1,memory_order_release);
+         m_tail.notify_one();
+         m_writer.join();
+         setp(nullptr,nullptr);
+         if (m_target->pubsync() == -1)
+         {
+            m_failed = true;
+         }
+         return !m_failed;
+      }
+   protected:
+      /*! Submits the current block and continues with the next free block.
+       *\param c Character that does not fit into the current block, or eof.
+       *\returns c or not eof if successful, and eof otherwise.
+       */
+      int_type overflow(int_type c) override
+      {
+         if (pbase() == nullptr || !submit())
+         {
+            return traits_type::eof();
+         }
+         if (!traits_type::eq_int_type(c,traits_type::eof()))
+         {
+            *pptr() = traits_type::to_char_type(c);
+            pbump(1);
+         }
+         return traits_type::not_eof(c);
+      }
+      /*! Submits the current block and waits until all blocks have been written.
+       *\returns 0 if successful, and -1 otherwise.
+       */
+      int sync() override
+      {
+         if (pbase() == nullptr || !submit())
+         {
+            return -1;
+         }
+         const maxnat_t tail { m_tail.load(memory_order_relaxed) };
+         for (maxnat_t head { m_head.load(memory_order_acquire) }; head != tail;
+              head = m_head.load(memory_order_acquire))
+         {
+            m_head.wait(head,memory_order_acquire);
+         }
+         return m_failed || m_target->pubsync() == -1 ? -1 : 0;
+      }
+      /*! Returns the number of bytes that have been output, so that tellp() works.
+       *  Other positions are not supported.
+       */
+      pos_type seekoff(off_type off,ios_base::seekdir dir,ios_base::openmode which) override
+      {
+         if (off != 0 || dir != ios_base::cur || !(which & ios_base::out))
+         {
+            return pos_type(off_type(-1));
+         }
+         return pos_type(static_cast<off_type>(m_submitted + (pptr() - pbase())));
+      }
+   private:
+      /*! Size that marks the end of the output.
+       */
+      static constexpr maxnat_t end_of_output { ~maxnat_t { 0 } };
+      /*! Makes block t the current block.
+       *\param t Number of the block, which is taken modulo the number of blocks.
+       */
+      void expose(maxnat_t t)
+      {
+         char* p { m_blocks[t % m_blocks.size()].data() };
+         setp(p,p + m_blocks[t % m_blocks.size()].size());
+      }
+      /*! Passes the current block to the writer thread, unless it is empty,
+       *  and waits until the next block is free.
+       *\returns False if the writer thread failed to write a block.
+       */
+      bool submit()
+      {
+         const maxnat_t size { static_cast<maxnat_t>(pptr() - pbase()) };
+         if (size == 0)
+         {
+            return !m_failed;
+         }
+         const maxnat_t tail { m_tail.load(memory_order_relaxed) + 1 };
+         m_sizes[(tail - 1) % m_blocks.size()] = size;
+         m_submitted += size;
+         m_tail.store(tail,memory_order_release);
+         m_tail.notify_one();
+         for (maxnat_t head { m_head.load(memory_order_acquire) }; tail - head >= m_blocks.size();
+              head = m_head.load(memory_order_acquire))
+         {
+            m_head.wait(head,memory_order_acquire);
+         }
+         expose(tail);
+         return !m_failed;
+      }
+      /*! Writes the submitted blocks in their order until the end of the output.
+       *  After a failure, the remaining blocks are discarded.
+       */
+      void run()
+      {
+         for (maxnat_t head { 0 }; ; )
+         {
+            for (maxnat_t tail { m_tail.load(memory_order_acquire) }; tail == head;
+                 tail = m_tail.load(memory_order_acquire))
+            {
+               m_tail.wait(tail,memory_order_acquire);
+            }
+            const maxnat_t size { m_sizes[head % m_blocks.size()] };
+            if (size == end_of_output)
+            {
+               return;
+            }
+            if (!m_failed && m_target->sputn(m_blocks[head % m_blocks.size()].data(),size) !=
+                             static_cast<streamsize>(size))
+            {
+               m_failed = true;
+            }
+            m_head.store(++head,memory_order_release);
+            m_head.notify_one();
+         }
+      }
+      streambuf* m_target;
+      vector<string> m_blocks;
+      vector<maxnat_t> m_sizes;
+      maxnat_t m_submitted { 0 };
+      atomic<maxnat_t> m_head { 0 },
+                       m_tail { 0 };
+      atomic<bool> m_failed { false };
+      thread m_writer;
+};
+
+/*! Exemplars of this class are output file streams whose output
+ *  is written by a writer thread, see async_streambuf.
+ *  They can be used instead of ofstream.
+ */
+class async_ofstream : public ostream
+{
+   public:
+      /*! An async output file stream exemplar must be initialized with the name of its file.
+       *\param file_name Name of the file, which is created or truncated.
+       */
+      explicit async_ofstream(const string& file_name)
+         :ostream { nullptr },
+          m_async { open(m_file,file_name) }
+      {
+         init(&m_async);
+         if (!m_file.is_open())
+         {
+            setstate(ios::failbit);
+         }
+      }
+      /*! Writes the remaining output and closes the file.
+       *  Sets failbit if not all output could be written.
+       */
+      void close()
+      {
+         if (!m_async.finish() || !m_file.close())
+         {
+            setstate(ios::failbit);
+         }
+      }
+   private:
+      /*! Opens a file buffer for output.
+       *\param file File buffer passed as reference.
+       *\param file_name Name of the file.
+       *\returns Pointer to the file buffer.
+       */
+      static filebuf* open(filebuf& file,const string& file_name)
+      {
+         file.open(file_name,ios::out | ios::trunc);
+         return &file;
+      }
+      filebuf m_file;
+      async_streambuf m_async;
+};
+
+/*! Outputs difference expressions for independent features to a file.
+ * This implementation creates and uses difference expressions.
+ *\param dg Difference generator to be used for generating difference expressions.
+ */
+void print_independent_features(const difference_expression_generator& dg)
+{
+   async_ofstream os { prefix + to_string(dg.F()) + "_F.csv" };
+
+   for (maxnat_t f { 1 };f <= dg.F(); ++f)
+   {
+      os << 'f' << f << '\t' << dg(f) << '\n';
+   }
+}
+
+/*! Outputs difference expressions for independent features to a file.
+ * This implementation does neither create nor uses difference expressions!
+ * Instead, the value that indicates if a system is to be intersected or to be
+ * united is calculated for each individual system.
+ * Therefore, this function has minimal memory requirements.
+ * In general, it is possible to provide corresponding implementations
+ * for all other following functions whose names begin with print_.
+ *\param dg Difference generator to be used for generating difference expressions.
+ */
+void print_independent_features_alt(const difference_expression_generator& dg)
+{
+   async_ofstream os { prefix + to_string(dg.F()) + "_F.csv" };
+
+   for (maxnat_t f { 1 };f <= dg.F(); ++f)
+   {
+      os << 'f' << f << '\t';
+      for (maxnat_t s { dg.S() }; s > 1; --s)
+      {
+         os << dg(f,s);
+      }
+      os << '\n';
+   }
+}
+
+/*! Outputs difference expressions for not features to a file.
+ * This implementation creates and uses difference expressions.
+ *\param dg Difference generator to be used for generating difference expressions.
+ */
+void print_not_features(const difference_expression_generator& dg)
+{
+   async_ofstream os { prefix + to_string(dg.F()) + "_N.csv" };
+
+   for (maxnat_t f { 1 };f <= dg.F(); ++f)
+   {
+      os << "!f" << f << '\t' << ~dg(f) << '\n';
+   }
+}
+
+/*! Outputs difference expressions for and features to a file.
+ * This implementation creates and uses difference expressions.
+ * The difference expressions are evaluated by a combination_evaluator.
+ *\param dg Difference generator to be used for generating difference expressions.
+ */
+void print_and_features(const difference_expression_generator& dg)
+{
+   async_ofstream os { prefix + to_string(dg.F()) + "_A.csv" };
+   pattern_cache patterns(dg);
+   combination_evaluator evaluate(patterns,operation_t::conjunction,false);
+   name_buffer name('*',false);
+   string line;
+
+   for (maxnat_t f { 2 }; f <= dg.F(); ++f)
+   {
+      combination_t c(dg.F(),f);
+      const auto features { c.state() };
+      do
+      {
+         write_line(os,line,name(features),evaluate(features),false);
+      } while (c.next());
+   }
+}
+
+/*! Outputs difference expressions for or features to a file.
+ * This implementation creates and uses difference expressions.
+ * The difference expressions are evaluated by a combination_evaluator.
+ *\param dg Difference generator to be used for generating difference expressions.
+ */
+void print_or_features(const difference_expression_generator& dg)
+{
+   async_ofstream os { prefix + to_string(dg.F()) + "_O.csv" };
+   pattern_cache patterns(dg);
+   combination_evaluator evaluate(patterns,operation_t::disjunction,false);
+   name_buffer name('+',false);
+   string line;
+
+   for (maxnat_t f { 2 }; f <= dg.F(); ++f)
+   {
+      combination_t c(dg.F(),f);
+      const auto features { c.state() };
+      do
+      {
+         write_line(os,line,name(features),evaluate(features),false);
+      } while (c.next());
+   }
+}
+
+/*! Outputs difference expressions for and-not features to a file.
+ * This implementation creates and uses difference expressions.
+ * The difference expressions are evaluated by a combination_evaluator.
+ *\param dg Difference generator to be used for generating difference expressions.
+ */
+void print_and_not_features(const difference_expression_generator& dg)
+{
+   async_ofstream os { prefix + to_string(dg.F()) + "_AN.csv" };
+   pattern_cache patterns(dg);
+   combination_evaluator evaluate(patterns,operation_t::conjunction,true);
+   name_buffer name('*',true);
+   string line;
+
+   for (maxnat_t f { 2 }; f <= dg.F(); ++f)
+   {
+      combination_t c(dg.F(),f);
+      const auto features { c.state() };
+      do
+      {
+         write_line(os,line,name(features),evaluate(features),false);
+      } while (c.next());
+   }
+}
+
+/*! Outputs difference expressions for or-not features to a file.
+ * This implementation creates and uses difference expressions.
+ * The difference expressions are evaluated by a combination_evaluator.
+ *\param dg Difference generator to be used for generating difference expressions.
+ */
+void print_or_not_features(const difference_expression_generator& dg)
+{
+   async_ofstream os { prefix + to_string(dg.F()) + "_ON.csv" };
+   pattern_cache patterns(dg);
+   combination_evaluator evaluate(patterns,operation_t::disjunction,true);
+   name_buffer name('+',true);
+   string line;
+
+   for (maxnat_t f { 2 }; f <= dg.F(); ++f)
+   {
+      combination_t c(dg.F(),f);
+      const auto features { c.state() };
+      do
+      {
+         write_line(os,line,name(features),evaluate(features),false);
+      } while (c.next());
+   }
+}
+
+/*! Outputs difference expressions for and features, or features,
+ *  and-not features, and or-not features to four files.
+ *  The combinations are enumerated only once and for each combination
+ *  only the and and the or of the independent features are calculated.
+ *  According to De Morgan's laws, the and-not feature equals the negated
+ *  or feature and the or-not feature equals the negated and feature.
+ *  The negation is performed while writing.
+ *  The files are identical to those that are created by
+ *  print_and_features(), print_or_features(), print_and_not_features(),
+ *  and print_or_not_features().
+ *\param dg Difference generator to be used for generating difference expressions.
+ */
+void print_fused_features(const difference_expression_generator& dg)
+{
+   async_ofstream os_a { prefix + to_string(dg.F()) + "_A.csv" },
+                  os_o { prefix + to_string(dg.F()) + "_O.csv" },
+                  os_an { prefix + to_string(dg.F()) + "_AN.csv" },
+                  os_on { prefix + to_string(dg.F()) + "_ON.csv" };
+   pattern_cache patterns(dg);
+   combination_evaluator evaluate_and(patterns,operation_t::conjunction,false),
+                         evaluate_or(patterns,operation_t::disjunction,false);
+   name_buffer a('*',false),
+               o('+',false),
+               an('*',true),
+               on('+',true);
+   string line;
+
+   for (maxnat_t f { 2 }; f <= dg.F(); ++f)
+   {
+      combination_t c(dg.F(),f);
+      const auto features { c.state() };
+      do
+      {
+         const auto& and_result { evaluate_and(features) };
+         const auto& or_result { evaluate_or(features) };
+         write_line(os_a,line,a(features),and_result,false);
+         write_line(os_o,line,o(features),or_result,false);
+         write_line(os_an,line,an(features),or_result,true);
+         write_line(os_on,line,on(features),and_result,true);
+      } while (c.next());
+   }
+}
+
+/*! Number of words of a tile, that is, 2^16 systems per tile.
+ */
+constexpr maxnat_t tile_words { 1024 };
+
+/*! Exemplars of this class write lines whose difference expressions are
+ *  calculated tile by tile, where a tile consists of tile_words consecutive
+ *  words of the system axis. The tiles are processed from the most significant
+ *  word downwards, which is the order in which the bits are written. Thus,
+ *  a difference expression is never created as a whole and the required
+ *  memory does not depend on F.
+ */
+class tiled_writer
+{
+   public:
+      /*! A tiled writer exemplar must be initialized with a difference expression generator.
+       *\param dg Difference generator to be used for generating the words of difference expressions.
+       */
+      explicit tiled_writer(const difference_expression_generator& dg)
+         :m_dg { dg },
+          m_words { ceil_div(dg.S(),word_bits) },
+          m_top_bits { dg.S() % word_bits ? dg.S() % word_bits : word_bits }
+      {
+         m_bits.reserve(tile_words * word_bits);
+      }
+      /*! Writes the lines for a combination of features to one or more streams.
+       *  For each tile, evaluate(first,last,words) stores the words first..last - 1
+       *  of all difference expressions in words, the words of expression i starting
+       *  at words[i * tile_words].
+       *\param streams Output streams, one per difference expression.
+       *\param names Names of features, one per difference expression.
+       *\param evaluate Function that calculates the words of a tile.
+       */
+      template <class Evaluate>
+      void write(span<ostream* const> streams,span<const string> names,Evaluate evaluate)
+      {
+         m_tile.resize(streams.size() * tile_words);
+         for (maxnat_t i { 0 }; i < streams.size(); ++i)
+         {
+            *streams[i] << names[i] << '\t';
+         }
+         for (maxnat_t last { m_words }; last > 0; )
+         {
+            const maxnat_t first { last > tile_words ? last - tile_words : 0 };
+            evaluate(first,last,m_tile.data());
+            for (maxnat_t i { 0 }; i < streams.size(); ++i)
+            {
+               m_bits.clear();
+               const word_t* words { m_tile.data() + i * tile_words };
+               for (maxnat_t w { last }; w > first; --w)
+               {
+                  const word_t value { words[w - 1 - first] };
+                  maxnat_t b { w == m_words ? m_top_bits : word_bits };
+                  for (; b % CHAR_BIT; --b)
+                  {
+                     m_bits.push_back(value >> (b - 1) & 1llu ? '1' : '0');
+                  }
+                  for (; b > 0; b -= CHAR_BIT)
+                  {
+                     m_bits.resize(m_bits.size() + CHAR_BIT);
+                     expand_byte(m_bits.data() + m_bits.size() - CHAR_BIT,value,b);
+                  }
+               }
+               streams[i]->write(m_bits.data(),m_bits.size());
+            }
+            last = first;
+         }
+         for (auto os : streams)
+         {
+            *os << '\n';
+         }
+      }
+      /*! Returns word w of independent feature f.
+       *\param f Feature-id (1..F)
+       *\param w Index of word.
+       *\returns Word w.
+       */
+      word_t word(maxnat_t f,maxnat_t w) const
+      {
+         return m_dg.word(f,w);
+      }
+   private:
+      const difference_expression_generator& m_dg;
+      const maxnat_t m_words,
+                     m_top_bits;
+      vector<word_t> m_tile;
+      string m_bits;
+};
+
+/*! Outputs difference expressions for all six feature categories to six files.
+ *  The system axis is processed in tiles by a tiled_writer, so that the
+ *  required memory is constant regardless of F. For each tile, the words of
+ *  the and and the or of a combination are calculated from the words of the
+ *  independent features, like in print_fused_features().
+ *  The files are identical to those created by print_independent_features(),
+ *  print_not_features(), and print_fused_features().
+ *\param dg Difference generator to be used for generating difference expressions.
+ */
+void print_tiled_features(const difference_expression_generator& dg)
+{
+   async_ofstream os_f { prefix + to_string(dg.F()) + "_F.csv" },
+                  os_n { prefix + to_string(dg.F()) + "_N.csv" },
+                  os_a { prefix + to_string(dg.F()) + "_A.csv" },
+                  os_o { prefix + to_string(dg.F()) + "_O.csv" },
+                  os_an { prefix + to_string(dg.F()) + "_AN.csv" },
+                  os_on { prefix + to_string(dg.F()) + "_ON.csv" };
+   tiled_writer writer(dg);
+   const array<ostream*,2> independent_streams { &os_f,&os_n };
+   const array<ostream*,4> fused_streams { &os_a,&os_o,&os_an,&os_on };
+   const word_t top_mask { dg.S() % word_bits ? (1llu << dg.S() % word_bits) - 1llu : ~word_t { 0 } };
+   const maxnat_t words { ceil_div(dg.S(),word_bits) };
+   // Negates a word and sets the bits that exceed S() to 0.
+   auto negate { [&] (word_t value,maxnat_t w) { return w + 1 == words ? ~value & top_mask : ~value; } };
+
+   for (maxnat_t f { 1 }; f <= dg.F(); ++f)
+   {
+      const array<string,2> names { "f"s + to_string(f),"!f"s + to_string(f) };
+      writer.write(independent_streams,names,
+                   [&] (maxnat_t first,maxnat_t last,word_t* tile)
+                   {
+                      for (maxnat_t w { first }; w < last; ++w)
+                      {
+                         tile[w - first] = writer.word(f,w);
+                         tile[tile_words + w - first] = negate(tile[w - first],w);
+                      }
+                   });
+   }
+   array<name_buffer,4> name_buffers { name_buffer('*',false),name_buffer('+',false),
+                                       name_buffer('*',true),name_buffer('+',true) };
+   array<string,4> names;
+   for (maxnat_t k { 2 }; k <= dg.F(); ++k)
+   {
+      combination_t c(dg.F(),k);
+      const auto features { c.state() };
+      do
+      {
+         for (maxnat_t i { 0 }; i < names.size(); ++i)
+         {
+            names[i] = name_buffers[i](features);
+         }
+         writer.write(fused_streams,names,
+                      [&] (maxnat_t first,maxnat_t last,word_t* tile)
+                      {
+                         for (maxnat_t w { first }; w < last; ++w)
+                         {
+                            word_t and_word { ~word_t { 0 } },
+                                   or_word { 0 };
+                            for (const auto e : features)
+                            {
+                               const word_t value { writer.word(e + 1,w) };
+                               and_word &= value;
+                               or_word |= value;
+                            }
+                            tile[w - first] = and_word;
+                            tile[tile_words + w - first] = or_word;
+                            tile[2 * tile_words + w - first] = negate(or_word,w);
+                            tile[3 * tile_words + w - first] = negate(and_word,w);
+                         }
+                      });
+      } while (c.next());
+   }
+}
+
+/*! Describes a contiguous range of combinations with sample size k.
+ *  The combinations are identified by their ranks, see combination_t::rank().
+ */
+struct chunk_t
+{
+   /*! Sample size.
+    */
+   combination_element_t k;
+   /*! Rank of first combination.
+    */
+   maxnat_t first;
+   /*! Number of combinations.
+    */
+   maxnat_t count;
+};
+
+/*! Describes the share of the combinations with sample sizes 2..F that
+ *  one of several executions calculates, for example on different nodes.
+ *  The combinations are numbered in the order in which the print_ functions
+ *  output them. Each shard receives a contiguous range of them, and the
+ *  sizes of the ranges differ by at most one. Thus, each shard performs the
+ *  same amount of work regardless of the sample sizes, and the files of the
+ *  shards can be concatenated in the order of the shards.
+ */
+struct shard_t
+{
+   /*! Number of shard (1..count).
+    */
+   maxnat_t index { 1 };
+   /*! Number of shards.
+    */
+   maxnat_t count { 1 };
+   /*! Returns number of first combination of shard.
+    *\param total Number of combinations with sample sizes 2..F.
+    *\returns Number of first combination.
+    */
+   maxnat_t first(maxnat_t total) const
+   {
+      return total / count * (index - 1) + min(index - 1,total % count);
+   }
+   /*! Returns number of combinations of shard.
+    *\param total Number of combinations with sample sizes 2..F.
+    *\returns Number of combinations.
+    */
+   maxnat_t size(maxnat_t total) const
+   {
+      return total / count + (index - 1 < total % count ? 1 : 0);
+   }
+   /*! Returns the suffix that is inserted before the extension of
+    *  the files of the shard, for example _2of4, or nothing if there is only one shard.
+    *\returns Suffix as value.
+    */
+   string suffix() const
+   {
+      return count == 1 ? "" : "_" + to_string(index) + "of" + to_string(count);
+   }
+};
+
+/*! Exemplars of this class split all combinations of F elements
+ *  with sample sizes 2..F, or those of a shard, into chunks of at
+ *  most size combinations.
+ *  The chunks are numbered in the order in which the print_ functions
+ *  output the combinations. They are calculated on demand,
+ *  so that the memory required does not depend on their number.
+ */
+class chunk_plan
+{
+   public:
+      /*! A chunk plan exemplar must be initialized with
+       *  the number of independent features and the maximum chunk size.
+       *\param F Number of independent features.
+       *\param size Maximum number of combinations per chunk.
+       *\param shard Shard whose combinations are split.
+       */
+      chunk_plan(maxnat_t F,maxnat_t size,const shard_t& shard = { }):m_F { F },m_size { max(size,maxnat_t { 1 }) }
+      {
+         maxnat_t total { 0 };
+         for (maxnat_t k { 2 }; k <= F; ++k)
+         {
+            total += binomial(F,k);
+         }
+         const maxnat_t first { shard.first(total) },
+                        last { first + shard.size(total) };
+         maxnat_t offset { 0 };
+         m_offsets.push_back(0);
+         for (maxnat_t k { 2 }; k <= F; ++k)
+         {
+            // Ranks of the combinations with sample size k that belong to the shard.
+            const maxnat_t n { binomial(F,k) },
+                           begin { min(first - min(first,offset),n) },
+                           end { min(last - min(last,offset),n) };
+            m_begins.push_back(begin);
+            m_ends.push_back(end);
+            m_offsets.push_back(m_offsets.back() + ceil_div(end - begin,m_size));
+            offset += n;
+         }
+      }
+      /*! Returns number of chunks.
+       *\returns Number of chunks.
+       */
+      maxnat_t size() const
+      {
+         return m_offsets.back();
+      }
+      /*! Returns chunk with given number.
+       *\param i Number of chunk (0..size() - 1).
+       *\returns Chunk as value.
+       */
+      chunk_t operator[](maxnat_t i) const
+      {
+         if constexpr (checking)
+         {
+            if (i >= size())
+            {
+               throw out_of_range("i >= size()");
+            }
+         }
+         const auto k_index { static_cast<maxnat_t>(upper_bound(m_offsets.begin(),m_offsets.end(),i) -
+                                                    m_offsets.begin()) - 1 };
+         const maxnat_t k { k_index + 2 };
+         const maxnat_t first { m_begins[k_index] + (i - m_offsets[k_index]) * m_size };
+         return { static_cast<combination_element_t>(k),first,min(m_size,m_ends[k_index] - first) };
+      }
+   private:
+      const maxnat_t m_F;
+      const maxnat_t m_size;
+      vector<maxnat_t> m_offsets;
+      vector<maxnat_t> m_begins;
+      vector<maxnat_t> m_ends;
+};
+
+/*! Number of bytes of output that a chunk should produce per file.
+ *  Together with the number of threads, it limits the memory
+ *  that is required for buffering results.
+ */
+constexpr maxnat_t chunk_bytes { 1llu << 18 };
+
+/*! Calculates chunks with a pool of threads and passes their results
+ *  to consume in the order of the chunks. Thus, the output does not
+ *  depend on the number of threads. At most two chunks per thread are
+ *  calculated or waiting to be consumed at any point in time.
+ *\param plan Chunks to be calculated.
+ *\param threads Number of threads that calculate chunks.
+ *\param make_producer Function that is called once per thread. It returns
+ *  a function that calculates a chunk and stores its results in a buffer.
+ *\param consume Function that is called by the calling thread for each
+ *  buffer in the order of the chunks.
+ */
+template <class Buffer,class MakeProducer,class Consume>
+void run_chunks(const chunk_plan& plan,unsigned threads,MakeProducer make_producer,Consume consume)
+{
+   threads = max(threads,1u);
+   const maxnat_t slots { 2llu * threads };
+   vector<Buffer> buffers(slots);
+   vector<char> ready(slots,false);
+   maxnat_t next_chunk { 0 },
+            consumed { 0 };
+   exception_ptr error { };
+   mutex m;
+   condition_variable cv;
+
+   auto work { [&] ()
+               {
+                  try
+                  {
+                     auto produce { make_producer() };
+                     Buffer buffer { };
+                     for (;;)
+                     {
+                        maxnat_t i { };
+                        {
+                           unique_lock lock { m };
+                           cv.wait(lock,[&] { return error || next_chunk >= plan.size() ||
+                                                     next_chunk < consumed + slots; });
+                           if (error || next_chunk >= plan.size())
+                           {
+                              return;
+                           }
+                           i = next_chunk++;
+                        }
+                        produce(plan[i],buffer);
+                        {
+                           lock_guard lock { m };
+                           swap(buffers[i % slots],buffer);
+                           ready[i % slots] = true;
+                        }
+                        cv.notify_all();
+                     }
+                  }
+                  catch (...)
+                  {
+                     {
+                        lock_guard lock { m };
+                        error = current_exception();
+                     }
+                     cv.notify_all();
+                  }
+               }
+             };
+   vector<thread> pool;
+   for (unsigned t { 0 }; t < threads; ++t)
+   {
+      pool.emplace_back(work);
+   }
+   try
+   {
+      Buffer buffer { };
+      for (maxnat_t i { 0 }; i < plan.size(); ++i)
+      {
+         {
+            unique_lock lock { m };
+            cv.wait(lock,[&] { return error || ready[i % slots]; });
+            if (error)
+            {
+               break;
+            }
+            swap(buffers[i % slots],buffer);
+            ready[i % slots] = false;
+            ++consumed;
+         }
+         cv.notify_all();
+         consume(buffer);
+      }
+   }
+   catch (...)
+   {
+      {
+         lock_guard lock { m };
+         error = current_exception();
+      }
+      cv.notify_all();
+   }
+   for (auto& t : pool)
+   {
+      t.join();
+   }
+   if (error)
+   {
+      rethrow_exception(error);
+   }
+}
+
+/*! Determines how the results of a chunk are formatted.
+ */
+enum class format_t
+{
+   /*! Lines as in the CSV files.
+    */
+   text,
+   /*! Packed words of the binary format.
+    */
+   binary,
+   /*! Records of the compressed variant of the binary format.
+    */
+   compressed
+};
+
+/*! Results of a chunk for the and, or, and-not, and or-not features
+ *  (in this order).
+ */
+struct fused_buffer_t
+{
+   /*! Formatted lines, or packed words or records in the binary formats.
+    */
+   array<string,4> data;
+   /*! Names of the features in the binary formats.
+    */
+   array<vector<string>,4> names;
+   /*! Ends of the records in data in the compressed variant of the binary format.
+    */
+   array<vector<maxnat_t>,4> ends;
+};
+
+/*! Symbols of the feature categories that are output by the fused functions
+ *  in the order of fused_buffer_t.
+ */
+const array<string,4> fused_categories { "A","O","AN","ON" };
+
+/*! Exemplars of this class format the results of a chunk for the
+ *  and, or, and-not, and or-not features in the same way as
+ *  print_fused_features(), or in one of the binary formats.
+ *  Each thread requires its own exemplar.
+ */
+class fused_chunk_formatter
+{
+   public:
+      /*! A fused chunk formatter exemplar must be initialized with
+       *  the number of independent features and a pattern cache.
+       *\param F Number of independent features.
+       *\param patterns Pattern cache that provides the terms.
+       *\param format Format of the results.
+       */
+      fused_chunk_formatter(maxnat_t F,const pattern_cache& patterns,format_t format = format_t::text)
+         :m_F { F },
+          m_format { format },
+          m_evaluate_and(patterns,operation_t::conjunction,false),
+          m_evaluate_or(patterns,operation_t::disjunction,false),
+          m_names { name_buffer('*',false),name_buffer('+',false),
+                    name_buffer('*',true),name_buffer('+',true) }
+      {}
+      /*! Formats the results of a chunk.
+       *\param chunk Chunk whose results are formatted.
+       *\param buffer Buffer that receives the results, passed as reference.
+       */
+      void operator()(const chunk_t& chunk,fused_buffer_t& buffer)
+      {
+         for (maxnat_t i { 0 }; i < buffer.data.size(); ++i)
+         {
+            buffer.data[i].clear();
+            buffer.names[i].clear();
+            buffer.ends[i].clear();
+         }
+         combination_t c(m_F,chunk.k);
+         c.unrank(chunk.first);
+         const auto features { c.state() };
+         for (maxnat_t n { 0 }; n < chunk.count; ++n)
+         {
+            if (n > 0)
+            {
+               c.next();
+            }
+            const auto& and_result { m_evaluate_and(features) };
+            const auto& or_result { m_evaluate_or(features) };
+            const array<const difference_expression_t*,4> results { &and_result,&or_result,
+                                                                    &or_result,&and_result };
+            for (maxnat_t i { 0 }; i < results.size(); ++i)
+            {
+               const auto& name { m_names[i](features) };
+               if (m_format == format_t::binary)
+               {
+                  buffer.names[i].push_back(name);
+                  append_words(buffer.data[i],*results[i],i >= 2);
+               }
+               else if (m_format == format_t::compressed)
+               {
+                  buffer.names[i].push_back(name);
+                  append_compressed(buffer.data[i],*results[i],i >= 2);
+                  buffer.ends[i].push_back(buffer.data[i].size());
+               }
+               else
+               {
+                  buffer.data[i] += name;
+                  buffer.data[i] += '\t';
+                  append_bits(buffer.data[i],*results[i],i >= 2);
+                  buffer.data[i] += '\n';
+               }
+            }
+         }
+      }
+   private:
+      const maxnat_t m_F;
+      const format_t m_format;
+      combination_evaluator m_evaluate_and,
+                            m_evaluate_or;
+      array<name_buffer,4> m_names;
+};
+
+/*! Outputs difference expressions for and features, or features,
+ *  and-not features, and or-not features to four files
+ *  like print_fused_features(), but calculates them with several threads.
+ *  The files are identical to those of print_fused_features().
+ *  If there are several shards, only the lines of the given shard are written
+ *  to files whose names contain the suffix of the shard.
+ *\param dg Difference generator to be used for generating difference expressions.
+ *\param threads Number of threads that calculate difference expressions.
+ *\param shard Shard whose lines are written.
+ */
+void print_fused_features_parallel(const difference_expression_generator& dg,unsigned threads,const shard_t& shard = { })
+{
+   vector<unique_ptr<async_ofstream>> os;
+   for (maxnat_t i { 0 }; i < fused_categories.size(); ++i)
+   {
+      os.push_back(make_unique<async_ofstream>(prefix + to_string(dg.F()) + "_" + fused_categories[i] +
+                                               shard.suffix() + ".csv"));
+   }
+   const pattern_cache patterns(dg);
+   const chunk_plan plan(dg.F(),chunk_bytes / (dg.S() + 1),shard);
+
+   run_chunks<fused_buffer_t>(plan,threads,
+                              [&] () { return fused_chunk_formatter(dg.F(),patterns); },
+                              [&] (const fused_buffer_t& buffer)
+                              {
+                                 for (maxnat_t i { 0 }; i < os.size(); ++i)
+                                 {
+                                    *os[i] << buffer.data[i];
+                                 }
+                              });
+}
+
+/*! Returns number of decimal digits of n.
+ *\param n Natural number.
+ *\returns Number of decimal digits.
+ */
+maxnat_t digits(maxnat_t n)
+{
+   maxnat_t result { 1 };
+   while (n >= 10)
+   {
+      n /= 10;
+      ++result;
+   }
+   return result;
+}
+
+/*! Exemplars of this class calculate the position of each line in the
+ *  files for and, or, and-not, and or-not features in closed form.
+ *  A line for a combination of k features consists of k terms,
+ *  each of them consisting of term_size characters ("f" or "!f") plus
+ *  the digits of the feature-id, k - 1 operators, a tab, S bits, and
+ *  a newline. The digits of all combinations that precede a given
+ *  combination are counted with binomial coefficients instead
+ *  of enumerating the combinations.
+ */
+class line_layout
+{
+   public:
+      /*! A line layout exemplar must be initialized with the number of
+       *  independent features, the number of systems, and the size of a
+       *  term without digits.
+       *\param F Number of independent features.
+       *\param S Number of systems.
+       *\param term_size Number of characters of a term without digits.
+       */
+      line_layout(maxnat_t F,maxnat_t S,maxnat_t term_size)
+         :m_F { F },m_S { S },m_term_size { term_size },m_digits(F + 1,0)
+      {
+         for (maxnat_t v { F }; v > 0; --v)
+         {
+            m_digits[v - 1] = m_digits[v] + digits(v);
+         }
+         m_offsets.assign(3,0);
+         for (maxnat_t k { 2 }; k <= F; ++k)
+         {
+            m_offsets.push_back(m_offsets.back() +
+                                binomial(F,k) * fixed_size(k) +
+                                binomial(F - 1,k - 1) * m_digits[0]);
+         }
+      }
+      /*! Returns number of characters of a line without the digits.
+       *\param k Sample size.
+       *\returns Number of characters.
+       */
+      maxnat_t fixed_size(maxnat_t k) const
+      {
+         return k * (m_term_size + 1) + m_S + 1;
+      }
+      /*! Returns size of the file.
+       *\returns Size in bytes.
+       */
+      maxnat_t size() const
+      {
+         return m_offsets.back();
+      }
+      /*! Returns position of the line for a combination.
+       *\param k Sample size of combination.
+       *\param r Rank of combination.
+       *\returns Position in bytes.
+       */
+      maxnat_t offset(combination_element_t k,maxnat_t r) const
+      {
+         if (r == binomial(m_F,k))
+         {
+            return m_offsets.at(k + 1);
+         }
+         combination_t c(m_F,k);
+         c.unrank(r);
+         const auto state { c.state() };
+         maxnat_t result { m_offsets.at(k) + r * fixed_size(k) },
+                  prefix_digits { 0 },
+                  previous { 0 };
+         for (maxnat_t i { 0 }; i < k; ++i)
+         {
+            // All combinations with the same first i elements, whose
+            // element i is smaller than state[i], precede the combination.
+            for (maxnat_t v { previous }; v < state[i]; ++v)
+            {
+               const maxnat_t rest { k - i - 1 };
+               result += binomial(m_F - 1 - v,rest) * (prefix_digits + digits(v + 1));
+               if (rest > 0)
+               {
+                  result += binomial(m_F - 2 - v,rest - 1) * m_digits[v + 1];
+               }
+            }
+            prefix_digits += digits(state[i] + 1);
+            previous = state[i] + 1;
+         }
+         return result;
+      }
+   private:
+      const maxnat_t m_F;
+      const maxnat_t m_S;
+      const maxnat_t m_term_size;
+      /*! m_digits[v] is the sum of the digits of the feature-ids v + 1..F.
+       */
+      vector<maxnat_t> m_digits;
+      /*! m_offsets[k] is the position of the first line with k features.
+       */
+      vector<maxnat_t> m_offsets;
+};
+
+#if defined(__unix__) || defined(__APPLE__)
+/*! Exemplars of this class represent a file of fixed size that
+ *  is written with pwrite at arbitrary positions by several threads.
+ */
+class positional_file
+{
+   public:
+      /*! Creates or truncates a file and sets its size.
+       *\param name Name of the file.
+       *\param size Size of the file in bytes.
+       */
+      positional_file(const string& name,maxnat_t size)
+         :m_fd { ::open(name.c_str(),O_WRONLY | O_CREAT | O_TRUNC,0644) }
+      {
+         if (m_fd < 0)
+         {
+            throw runtime_error(name + ": " + strerror(errno));
+         }
+         if (::ftruncate(m_fd,static_cast<off_t>(size)) != 0)
+         {
+            const string message { name + ": " + strerror(errno) };
+            ::close(m_fd);
+            throw runtime_error(message);
+         }
+      }
+      positional_file(const positional_file&) = delete;
+      positional_file& operator=(const positional_file&) = delete;
+      ~positional_file()
+      {
+         ::close(m_fd);
+      }
+      /*! Writes data at given position.
+       *\param offset Position in bytes.
+       *\param data Data to be written.
+       */
+      void write_at(maxnat_t offset,const string& data) const
+      {
+         maxnat_t written { 0 };
+         while (written < data.size())
+         {
+            const auto n { ::pwrite(m_fd,data.data() + written,data.size() - written,
+                                    static_cast<off_t>(offset + written)) };
+            if (n < 0)
+            {
+               if (errno == EINTR)
+               {
+                  continue;
+               }
+               throw runtime_error(strerror(errno));
+            }
+            written += n;
+         }
+      }
+   private:
+      const int m_fd;
+};
+
+/*! Outputs difference expressions for and features, or features,
+ *  and-not features, and or-not features to four files like
+ *  print_fused_features_parallel(). However, the files are preallocated
+ *  and each thread writes its chunks directly at the positions that are
+ *  calculated by line_layout. Therefore, the threads never wait for
+ *  each other. The files are identical to those of print_fused_features().
+ *\param dg Difference generator to be used for generating difference expressions.
+ *\param threads Number of threads that calculate and write difference expressions.
+ */
+void print_fused_features_positional(const difference_expression_generator& dg,unsigned threads)
+{
+   const array<line_layout,4> layouts { line_layout(dg.F(),dg.S(),1),
+                                        line_layout(dg.F(),dg.S(),1),
+                                        line_layout(dg.F(),dg.S(),2),
+                                        line_layout(dg.F(),dg.S(),2) };
+   vector<unique_ptr<positional_file>> files;
+   for (maxnat_t i { 0 }; i < layouts.size(); ++i)
+   {
+      files.push_back(make_unique<positional_file>(prefix + to_string(dg.F()) + "_" +
+                                                   fused_categories[i] + ".csv",
+                                                   layouts[i].size()));
+   }
+   const pattern_cache patterns(dg);
+   const chunk_plan plan(dg.F(),chunk_bytes / (dg.S() + 1));
+   atomic<maxnat_t> next_chunk { 0 };
+   mutex m;
+   exception_ptr error { };
+
+   auto work { [&] ()
+               {
+                  try
+                  {
+                     fused_chunk_formatter format(dg.F(),patterns);
+                     fused_buffer_t buffer { };
+                     for (maxnat_t i { next_chunk++ }; i < plan.size(); i = next_chunk++)
+                     {
+                        const auto chunk { plan[i] };
+                        format(chunk,buffer);
+                        for (maxnat_t c { 0 }; c < files.size(); ++c)
+                        {
+                           const auto offset { layouts[c].offset(chunk.k,chunk.first) };
+                           if constexpr (checking)
+                           {
+                              if (offset + buffer.data[c].size() != layouts[c].offset(chunk.k,chunk.first + chunk.count))
+                              {
+                                 throw logic_error("line_layout does not match chunk");
+                              }
+                           }
+                           files[c]->write_at(offset,buffer.data[c]);
+                        }
+                     }
+                  }
+                  catch (...)
+                  {
+                     lock_guard lock { m };
+                     error = current_exception();
+                     next_chunk = plan.size();
+                  }
+               }
+             };
+   vector<thread> pool;
+   for (unsigned t { 0 }; t < max(threads,1u); ++t)
+   {
+      pool.emplace_back(work);
+   }
+   for (auto& t : pool)
+   {
+      t.join();
+   }
+   if (error)
+   {
+      rethrow_exception(error);
+   }
+}
+#endif
+
+/*! Header of a file in the binary format. The layout is the same as that
+ *  of features::binary_header_t in features.hpp, whose binary_results_t
+ *  provides memory-mapped read access to the files created by this program.
+ *  A file contains count difference expressions that occupy stride bytes
+ *  each, followed by count + 1 positions of names and the names.
+ *  In the compressed variant, the difference expressions are records of
+ *  variable size, see append_compressed(), which are followed by an index
+ *  of count + 1 positions of the records at index_offset.
+ */
+struct binary_header_t
+{
+   char magic[8];
+   uint64_t F;
+   uint64_t M;
+   char category[8];
+   uint64_t S;
+   uint64_t count;
+   uint64_t stride;
+   uint64_t data_offset;
+   uint64_t names_offset;
+   uint64_t names_size;
+   uint64_t index_offset;
+   uint64_t reserved[5];
+};
+static_assert(sizeof(binary_header_t) == 128);
+static_assert(endian::native == endian::little,"The binary format requires a little-endian platform.");
+
+/*! Exemplars of this class write a file in the binary format or in its
+ *  compressed variant. The difference expressions are written immediately,
+ *  whereas the names, and the index of the records of the compressed variant,
+ *  are collected and written by finish(), which also completes the header.
+ */
+class binary_writer
+{
+   public:
+      /*! A binary writer exemplar must be initialized with the name of the file,
+       *  the number of independent features, the category, and the number
+       *  of difference expressions to be written.
+       *\param name Name of file.
+       *\param F Number of independent features.
+       *\param category Symbol of feature category.
+       *\param count Number of difference expressions.
+       *\param compressed True if the compressed variant is to be written.
+       */
+      binary_writer(const string& name,maxnat_t F,const string& category,maxnat_t count,bool compressed = false)
+         :m_os { name,ios::binary },m_header { },m_compressed { compressed }
+      {
+         if (!m_os)
+         {
+            throw runtime_error(name + " cannot be created.");
+         }
+         memcpy(m_header.magic,compressed ? "FLRLE001" : "FLBITS01",sizeof(m_header.magic));
+         memcpy(m_header.category,category.data(),min(category.size(),sizeof(m_header.category) - 1));
+         m_header.F = F;
+         m_header.M = 19; // fl.cpp always calculates model M19.
+         m_header.S = power(2,F);
+         m_header.count = count;
+         m_header.stride = ceil_div(m_header.S,word_bits) * sizeof(word_t);
+         m_header.data_offset = sizeof(m_header);
+         m_header.names_offset = m_header.data_offset + count * m_header.stride;
+         m_positions.push_back(0);
+         m_records.push_back(0);
+         m_os.write(reinterpret_cast<const char*>(&m_header),sizeof(m_header));
+      }
+      /*! Writes a difference expression and collects the name of the feature.
+       *\param feature Name of feature.
+       *\param de Difference expression.
+       *\param negated True if the negated difference expression is to be written.
+       */
+      void append(const string& feature,const difference_expression_t& de,bool negated = false)
+      {
+         m_words.clear();
+         if (m_compressed)
+         {
+            append_compressed(m_words,de,negated);
+            const maxnat_t end { m_words.size() };
+            append_raw(m_words,{ &feature,1 },{ &end,1 });
+         }
+         else
+         {
+            append_words(m_words,de,negated);
+            append_raw(m_words,{ &feature,1 });
+         }
+      }
+      /*! Writes difference expressions and collects the names of the features.
+       *\param data Packed words of difference expressions, or their records in the compressed variant.
+       *\param features Names of features.
+       *\param ends Ends of the records in data, only for the compressed variant.
+       */
+      void append_raw(const string& data,span<const string> features,span<const maxnat_t> ends = { })
+      {
+         if constexpr (checking)
+         {
+            if (m_compressed ? ends.size() != features.size() || (!ends.empty() && ends.back() != data.size())
+                             : data.size() != features.size() * m_header.stride)
+            {
+               throw length_error("data does not match features");
+            }
+         }
+         m_os.write(data.data(),data.size());
+         for (const auto end : ends)
+         {
+            m_records.push_back(m_data_size + end);
+         }
+         m_data_size += data.size();
+         for (const auto& f : features)
+         {
+            m_names += f;
+            m_positions.push_back(m_names.size());
+         }
+      }
+      /*! Writes the index of the records of the compressed variant and the names,
+       *  and completes the header.
+       */
+      void finish()
+      {
+         if (m_positions.size() != m_header.count + 1 || (m_compressed && m_records.size() != m_header.count + 1))
+         {
+            throw logic_error("Number of difference expressions does not match header.");
+         }
+         if (m_compressed)
+         {
+            m_header.index_offset = m_header.data_offset + m_data_size;
+            m_header.names_offset = m_header.index_offset + m_records.size() * sizeof(uint64_t);
+            m_os.write(reinterpret_cast<const char*>(m_records.data()),m_records.size() * sizeof(uint64_t));
+         }
+         m_os.write(reinterpret_cast<const char*>(m_positions.data()),m_positions.size() * sizeof(uint64_t));
+         m_os.write(m_names.data(),m_names.size());
+         m_header.names_size = m_positions.size() * sizeof(uint64_t) + m_names.size();
+         m_os.seekp(0);
+         m_os.write(reinterpret_cast<const char*>(&m_header),sizeof(m_header));
+         m_os.close();
+         if (!m_os)
+         {
+            throw runtime_error("Binary file cannot be written.");
+         }
+      }
+   private:
+      ofstream m_os;
+      binary_header_t m_header;
+      const bool m_compressed;
+      maxnat_t m_data_size { 0 };
+      vector<uint64_t> m_records;
+      vector<uint64_t> m_positions;
+      string m_names;
+      string m_words;
+};
+
+/*! Reads and checks the header of a file in the binary format.
+ *\param is Input stream of the file, which is positioned after the header.
+ *\param name Name of file.
+ *\param F Number of independent features.
+ *\param category Symbol of feature category.
+ *\param compressed True if the file is expected in the compressed variant.
+ *\returns Header as value.
+ */
+binary_header_t read_binary_header(istream& is,const string& name,maxnat_t F,const string& category,
+                                   bool compressed = false)
+{
+   binary_header_t result { };
+   if (!is.read(reinterpret_cast<char*>(&result),sizeof(result)))
+   {
+      throw runtime_error(name + " cannot be read.");
+   }
+   if (memcmp(result.magic,compressed ? "FLRLE001" : "FLBITS01",sizeof(result.magic)) != 0 ||
+       result.F != F || result.M != 19 || result.S != power(2,F) ||
+       string(result.category,strnlen(result.category,sizeof(result.category))) != category)
+   {
+      throw runtime_error(name + " does not contain " + category + " for F = " + to_string(F) + ".");
+   }
+   return result;
+}
+
+/*! Exemplars of this class read the difference expressions of a file
+ *  in the binary format that has been written by a binary_writer.
+ */
+class binary_reader
+{
+   public:
+      /*! A binary reader exemplar must be initialized with the name of the file,
+       *  the number of independent features, and the category, which are checked.
+       *\param name Name of file.
+       *\param F Number of independent features.
+       *\param category Symbol of feature category.
+       */
+      binary_reader(const string& name,maxnat_t F,const string& category)
+         :m_is { name,ios::binary },m_header { read_binary_header(m_is,name,F,category) }
+      {}
+      /*! Returns number of difference expressions.
+       *\returns Number of difference expressions.
+       */
+      maxnat_t count() const
+      {
+         return m_header.count;
+      }
+      /*! Reads a difference expression.
+       *\param i Index of difference expression (0..count() - 1).
+       *\param de Difference expression with header S bits, which receives the words.
+       */
+      void read(maxnat_t i,difference_expression_t& de)
+      {
+         if constexpr (checking)
+         {
+            if (i >= count() || de.size() != m_header.S)
+            {
+               throw invalid_argument("i >= count() || de.size() != S");
+            }
+         }
+         m_is.seekg(m_header.data_offset + i * m_header.stride);
+         if (!m_is.read(reinterpret_cast<char*>(de.data()),de.word_count() * sizeof(word_t)))
+         {
+            throw runtime_error("Binary file is truncated.");
+         }
+      }
+   private:
+      ifstream m_is;
+      binary_header_t m_header;
+};
+
+/*! Outputs difference expressions for independent features and not features
+ *  to two files in the binary format.
+ *\param dg Difference generator to be used for generating difference expressions.
+ *\param compressed True if the compressed variant of the binary format is to be written.
+ */
+void print_independent_and_not_features_binary(const difference_expression_generator& dg,bool compressed = false)
+{
+   const string extension { compressed ? ".rle" : ".bin" };
+   binary_writer independent { prefix + to_string(dg.F()) + "_F" + extension,dg.F(),"F",dg.F(),compressed },
+                 negated { prefix + to_string(dg.F()) + "_N" + extension,dg.F(),"N",dg.F(),compressed };
+   for (maxnat_t f { 1 }; f <= dg.F(); ++f)
+   {
+      const auto de { dg(f) };
+      independent.append("f" + to_string(f),de);
+      negated.append("!f" + to_string(f),de,true);
+   }
+   independent.finish();
+   negated.finish();
+}
+
+/*! Outputs difference expressions for and features, or features,
+ *  and-not features, and or-not features to four files in the binary format.
+ *  The order of the difference expressions is the same as in the
+ *  files created by print_fused_features().
+ *\param dg Difference generator to be used for generating difference expressions.
+ *\param threads Number of threads that calculate difference expressions.
+ *\param compressed True if the compressed variant of the binary format is to be written.
+ *\param shard Shard whose difference expressions are written, see print_fused_features_parallel().
+ */
+void print_fused_features_binary(const difference_expression_generator& dg,unsigned threads,bool compressed = false,
+                                 const shard_t& shard = { })
+{
+   maxnat_t count { 0 };
+   for (maxnat_t k { 2 }; k <= dg.F(); ++k)
+   {
+      count += binomial(dg.F(),k);
+   }
+   vector<unique_ptr<binary_writer>> writers;
+   for (const auto& category : fused_categories)
+   {
+      writers.push_back(make_unique<binary_writer>(prefix + to_string(dg.F()) + "_" + category + shard.suffix() +
+                                                   (compressed ? ".rle" : ".bin"),dg.F(),category,
+                                                   shard.size(count),compressed));
+   }
+   const pattern_cache patterns(dg);
+   const chunk_plan plan(dg.F(),chunk_bytes * CHAR_BIT / (dg.S() + 1),shard);
+
+   run_chunks<fused_buffer_t>(plan,threads,
+                              [&] ()
+                              {
+                                 return fused_chunk_formatter(dg.F(),patterns,
+                                                              compressed ? format_t::compressed : format_t::binary);
+                              },
+                              [&] (const fused_buffer_t& buffer)
+                              {
+                                 for (maxnat_t i { 0 }; i < writers.size(); ++i)
+                                 {
+                                    writers[i]->append_raw(buffer.data[i],buffer.names[i],buffer.ends[i]);
+                                 }
+                              });
+   for (auto& w : writers)
+   {
+      w->finish();
+   }
+}
+
+/*! Outputs difference expressions for and features, or features,
+ *  and-not features, and or-not features to four files in the binary format.
+ *  The difference expressions are derived from the files for and features and
+ *  or features with F - 1 independent features, which must have been created
+ *  before, for example by an execution with --binary. A combination that does
+ *  not contain f_F repeats its previous difference expression. A combination
+ *  that contains f_F extends the previous difference expression of its
+ *  other features. Thus, no difference expression is calculated from scratch.
+ *  The files are identical to those created by print_fused_features_binary().
+ *\param dg Difference generator to be used for generating difference expressions.
+ */
+void print_fused_features_incremental(const difference_expression_generator& dg)
+{
+   if (dg.F() < 2)
+   {
+      throw invalid_argument("Incremental calculation requires F >= 2.");
+   }
+   const difference_expression_generator previous(dg.F() - 1);
+   binary_reader previous_and { prefix + to_string(previous.F()) + "_A.bin",previous.F(),"A" },
+                 previous_or { prefix + to_string(previous.F()) + "_O.bin",previous.F(),"O" };
+   // Returns index of first combination with sample size k for F - 1.
+   auto first { [&] (maxnat_t k)
+                {
+                   maxnat_t result { 0 };
+                   for (maxnat_t j { 2 }; j < k; ++j)
+                   {
+                      result += binomial(previous.F(),j);
+                   }
+                   return result;
+                }
+              };
+   maxnat_t count { 0 };
+   for (maxnat_t k { 2 }; k <= dg.F(); ++k)
+   {
+      count += binomial(dg.F(),k);
+   }
+   binary_writer os_a { prefix + to_string(dg.F()) + "_A.bin",dg.F(),"A",count },
+                 os_o { prefix + to_string(dg.F()) + "_O.bin",dg.F(),"O",count },
+                 os_an { prefix + to_string(dg.F()) + "_AN.bin",dg.F(),"AN",count },
+                 os_on { prefix + to_string(dg.F()) + "_ON.bin",dg.F(),"ON",count };
+   difference_expression_t and_previous(previous.S()),
+                           or_previous(previous.S());
+   name_buffer a('*',false),
+               o('+',false),
+               an('*',true),
+               on('+',true);
+
+   for (maxnat_t k { 2 }; k <= dg.F(); ++k)
+   {
+      maxnat_t same { first(k) },
+               shorter { first(k - 1) };
+      combination_t c(dg.F(),k);
+      const auto features { c.state() };
+      do
+      {
+         extension_t and_extension { extension_t::repeated },
+                     or_extension { extension_t::repeated };
+         if (features[k - 1] == dg.F() - 1)
+         {
+            // The combination contains f_F.
+            if (k == 2)
+            {
+               and_previous = previous(features[0] + 1);
+               or_previous = and_previous;
+            }
+            else
+            {
+               previous_and.read(shorter,and_previous);
+               previous_or.read(shorter++,or_previous);
+            }
+            and_extension = extension_t::conjunction;
+            or_extension = extension_t::disjunction;
+         }
+         else
+         {
+            previous_and.read(same,and_previous);
+            previous_or.read(same++,or_previous);
+         }
+         const auto and_result { dg.extend(and_previous,and_extension) };
+         const auto or_result { dg.extend(or_previous,or_extension) };
+         os_a.append(a(features),and_result);
+         os_o.append(o(features),or_result);
+         os_an.append(an(features),or_result,true);
+         os_on.append(on(features),and_result,true);
+      } while (c.next());
+   }
+   os_a.finish();
+   os_o.finish();
+   os_an.finish();
+   os_on.finish();
+}
+
+/*! Version of the engine that writes the files. It is part of the names of
+ *  the entries of a result_cache, so that entries written by other versions
+ *  are never reused. It has to be incremented whenever the contents of the files change.
+ */
+constexpr unsigned engine_version { 1 };
+
+/*! Exemplars of this class keep copies of binary and compressed files in a
+ *  directory. An entry is identified by F, the feature category and the
+ *  extension of the file, for example fl_v1_F10_A.bin, so that its contents are
+ *  determined by its name. Entries are written to a temporary file first and
+ *  renamed afterwards, so that an interrupted run never leaves an incomplete entry.
+ */
+class result_cache
+{
+   public:
+      /*! Constructor that creates the directory if it does not exist and
+       *  removes the entries written by other versions of the engine.
+       *\param directory Directory of the entries.
+       */
+      explicit result_cache(const filesystem::path& directory)
+         :m_directory { directory }
+      {
+         filesystem::create_directories(m_directory);
+         const string current { prefix + "v" + to_string(engine_version) + "_" };
+         for (const auto& entry : filesystem::directory_iterator { m_directory })
+         {
+            const string name { entry.path().filename().string() };
+            if (name.size() > prefix.size() + 1 && name.compare(0,prefix.size() + 1,prefix + "v") == 0 &&
+                isdigit(static_cast<unsigned char>(name[prefix.size() + 1])) && name.compare(0,current.size(),current) != 0)
+            {
+               filesystem::remove(entry.path());
+            }
+         }
+      }
+      /*! Copies the entries of all categories into the working directory,
+       *  if all of them exist and are valid.
+       *\param F Number of independent features.
+       *\param categories Symbols of feature categories.
+       *\param extension Extension of the files, either ".bin" or ".rle".
+       *\returns True if the files were copied.
+       */
+      bool restore(maxnat_t F,initializer_list<const char*> categories,const string& extension) const
+      {
+         for (const auto category : categories)
+         {
+            if (!valid(entry(F,category,extension),F,category,extension))
+            {
+               return false;
+            }
+         }
+         for (const auto category : categories)
+         {
+            filesystem::copy_file(entry(F,category,extension),file(F,category,extension),
+                                  filesystem::copy_options::overwrite_existing);
+         }
+         return true;
+      }
+      /*! Copies the files of all categories from the working directory into the cache.
+       *\param F Number of independent features.
+       *\param categories Symbols of feature categories.
+       *\param extension Extension of the files, either ".bin" or ".rle".
+       */
+      void store(maxnat_t F,initializer_list<const char*> categories,const string& extension) const
+      {
+         for (const auto category : categories)
+         {
+            const auto target { entry(F,category,extension) };
+            auto temporary { target };
+            temporary += ".tmp" + to_string(random_device { }());
+            filesystem::copy_file(file(F,category,extension),temporary,filesystem::copy_options::overwrite_existing);
+            filesystem::rename(temporary,target);
+         }
+      }
+   private:
+      /*! Returns the name of a file in the working directory.
+       *\param F Number of independent features.
+       *\param category Symbol of feature category.
+       *\param extension Extension of the file.
+       *\returns Name of the file.
+       */
+      static filesystem::path file(maxnat_t F,const string& category,const string& extension)
+      {
+         return prefix + to_string(F) + "_" + category + extension;
+      }
+      /*! Returns the path of an entry.
+       *\param F Number of independent features.
+       *\param category Symbol of feature category.
+       *\param extension Extension of the file.
+       *\returns Path of the entry.
+       */
+      filesystem::path entry(maxnat_t F,const string& category,const string& extension) const
+      {
+         return m_directory / (prefix + "v" + to_string(engine_version) + "_F" + to_string(F) + "_" + category + extension);
+      }
+      /*! Checks whether an entry exists and its header matches F and category.
+       *  An entry that exists but does not match is removed.
+       *\param path Path of the entry.
+       *\param F Number of independent features.
+       *\param category Symbol of feature category.
+       *\param extension Extension of the file, which determines the magic.
+       *\returns True if the entry is valid.
+       */
+      static bool valid(const filesystem::path& path,maxnat_t F,const string& category,const string& extension)
+      {
+         if (!filesystem::exists(path))
+         {
+            return false;
+         }
+         binary_header_t header { };
+         ifstream is { path,ios::binary };
+         const bool result { is.read(reinterpret_cast<char*>(&header),sizeof(header)) &&
+                             memcmp(header.magic,extension == ".rle" ? "FLRLE001" : "FLBITS01",sizeof(header.magic)) == 0 &&
+                             header.F == F && header.M == 19 && header.S == power(2,F) &&
+                             string(header.category,strnlen(header.category,sizeof(header.category))) == category &&
+                             filesystem::file_size(path) >= header.names_offset + header.names_size };
+         if (!result)
+         {
+            is.close();
+            filesystem::remove(path);
+         }
+         return result;
+      }
+      const filesystem::path m_directory;
+};
+
+/*! Contents of the manifest of a shard that records which
+ *  combinations the shard has written to which files.
+ */
+struct manifest_t
+{
+   /*! Number of independent features.
+    */
+   maxnat_t F { 0 };
+   /*! Shard.
+    */
+   shard_t shard { };
+   /*! Number of first combination of shard.
+    */
+   maxnat_t first { 0 };
+   /*! Number of combinations of shard.
+    */
+   maxnat_t count { 0 };
+   /*! Extension of the files, for example ".csv".
+    */
+   string extension { };
+   /*! Names of the files in the order of fused_categories.
+    */
+   vector<string> files { };
+   /*! Sizes of the files in bytes.
+    */
+   vector<maxnat_t> sizes { };
+};
+
+/*! Returns the name of the manifest of a shard.
+ *\param F Number of independent features.
+ *\param shard Shard.
+ *\returns Name of the manifest, for example fl_24_2of4.manifest.
+ */
+string manifest_name(maxnat_t F,const shard_t& shard)
+{
+   return prefix + to_string(F) + shard.suffix() + ".manifest";
+}
+
+/*! Writes the manifest of a shard after its files have been written.
+ *  The manifest is written to a temporary file that is renamed afterwards,
+ *  so that a shard is complete if and only if its manifest exists.
+ *  Each line contains a key and its values separated by tabs.
+ *\param F Number of independent features.
+ *\param shard Shard.
+ *\param extension Extension of the files of the shard, for example ".csv".
+ */
+void write_manifest(maxnat_t F,const shard_t& shard,const string& extension)
+{
+   const maxnat_t total { power(2,F) - F - 1 };
+   const string name { manifest_name(F,shard) };
+   {
+      ofstream os { name + ".tmp" };
+      os << "F\t" << F << "\nshard\t" << shard.index << '\t' << shard.count
+         << "\nfirst\t" << shard.first(total) << "\ncount\t" << shard.size(total)
+         << "\nextension\t" << extension << '\n';
+      for (const auto& category : fused_categories)
+      {
+         const string file { prefix + to_string(F) + "_" + category + shard.suffix() + extension };
+         os << category << '\t' << file << '\t' << filesystem::file_size(file) << '\n';
+      }
+      if (!os.flush())
+      {
+         throw runtime_error(name + " cannot be written.");
+      }
+   }
+   filesystem::rename(name + ".tmp",name);
+}
+
+/*! Reads the manifest of a shard.
+ *\param name Name of the manifest.
+ *\returns Contents of the manifest as value.
+ */
+manifest_t read_manifest(const string& name)
+{
+   ifstream is { name };
+   if (!is)
+   {
+      throw runtime_error(name + " cannot be read, the shard is missing or incomplete.");
+   }
+   manifest_t result { };
+   string line;
+   while (getline(is,line))
+   {
+      istringstream fields { line };
+      string key;
+      fields >> key;
+      if (key == "F")
+      {
+         fields >> result.F;
+      }
+      else if (key == "shard")
+      {
+         fields >> result.shard.index >> result.shard.count;
+      }
+      else if (key == "first")
+      {
+         fields >> result.first;
+      }
+      else if (key == "count")
+      {
+         fields >> result.count;
+      }
+      else if (key == "extension")
+      {
+         fields >> result.extension;
+      }
+      else if (result.files.size() < fused_categories.size() && key == fused_categories[result.files.size()])
+      {
+         string file;
+         maxnat_t size { };
+         fields >> file >> size;
+         result.files.push_back(file);
+         result.sizes.push_back(size);
+      }
+      if (!fields)
+      {
+         throw runtime_error(name + " contains an invalid line: " + line);
+      }
+   }
+   return result;
+}
+
+/*! Appends all difference expressions of a file in the binary format,
+ *  or in its compressed variant, to a binary writer.
+ *  They are copied without decoding them, a limited number at a time.
+ *\param writer Binary writer passed as reference.
+ *\param name Name of the file.
+ *\param F Number of independent features.
+ *\param category Symbol of feature category.
+ *\param compressed True if the file is in the compressed variant.
+ */
+void append_binary_file(binary_writer& writer,const string& name,maxnat_t F,const string& category,bool compressed)
+{
+   ifstream is { name,ios::binary };
+   const auto header { read_binary_header(is,name,F,category,compressed) };
+   vector<uint64_t> records(compressed ? header.count + 1 : 0),
+                    positions(header.count + 1);
+   if (compressed)
+   {
+      is.seekg(header.index_offset);
+      is.read(reinterpret_cast<char*>(records.data()),records.size() * sizeof(uint64_t));
+   }
+   is.seekg(header.names_offset);
+   is.read(reinterpret_cast<char*>(positions.data()),positions.size() * sizeof(uint64_t));
+   string names(positions.back(),'\0');
+   is.read(names.data(),names.size());
+   const maxnat_t batch { max(chunk_bytes * CHAR_BIT / (header.S + 1),maxnat_t { 1 }) };
+   string data;
+   vector<string> features;
+   vector<maxnat_t> ends;
+   for (maxnat_t n { 0 }; is && n < header.count; n += batch)
+   {
+      const maxnat_t m { min(batch,header.count - n) },
+                     from { compressed ? records[n] : n * header.stride },
+                     to { compressed ? records[n + m] : (n + m) * header.stride };
+      data.resize(to - from);
+      is.seekg(header.data_offset + from);
+      is.read(data.data(),data.size());
+      features.clear();
+      ends.clear();
+      for (maxnat_t j { n }; j < n + m; ++j)
+      {
+         features.push_back(names.substr(positions[j],positions[j + 1] - positions[j]));
+         if (compressed)
+         {
+            ends.push_back(records[j + 1] - from);
+         }
+      }
+      writer.append_raw(data,features,ends);
+   }
+   if (!is)
+   {
+      throw runtime_error(name + " is truncated.");
+   }
+}
+
+/*! Merges the files of all shards of an execution with --shard into the
+ *  files of or-, and-, or-not-, and and-not-features for F, which are
+ *  identical to those of an execution without --shard. The files of
+ *  independent and not features have been written by the first shard.
+ *  The manifests of all shards are checked before anything is merged.
+ *  The files of the shards and their manifests are removed afterwards.
+ *\param F Number of independent features.
+ *\param shards Number of shards.
+ */
+void merge_shards(maxnat_t F,maxnat_t shards)
+{
+   const maxnat_t total { power(2,F) - F - 1 };
+   vector<manifest_t> manifests;
+   for (maxnat_t i { 1 }; i <= shards; ++i)
+   {
+      const shard_t shard { i,shards };
+      const string name { manifest_name(F,shard) };
+      auto manifest { read_manifest(name) };
+      if (manifest.F != F || manifest.shard.index != i || manifest.shard.count != shards ||
+          manifest.first != shard.first(total) || manifest.count != shard.size(total) ||
+          manifest.files.size() != fused_categories.size() ||
+          (!manifests.empty() && manifest.extension != manifests.front().extension))
+      {
+         throw runtime_error(name + " does not match shard " + to_string(i) + " of " + to_string(shards) +
+                             " for F = " + to_string(F) + ".");
+      }
+      for (maxnat_t c { 0 }; c < manifest.files.size(); ++c)
+      {
+         error_code ec;
+         if (filesystem::file_size(manifest.files[c],ec) != manifest.sizes[c] || ec)
+         {
+            throw runtime_error(manifest.files[c] + " does not match " + name + ".");
+         }
+      }
+      manifests.push_back(move(manifest));
+   }
+   const string extension { manifests.front().extension };
+   for (maxnat_t c { 0 }; c < fused_categories.size(); ++c)
+   {
+      const string target { prefix + to_string(F) + "_" + fused_categories[c] + extension };
+      if (extension == ".csv")
+      {
+         ofstream os { target,ios::binary };
+         for (const auto& manifest : manifests)
+         {
+            if (manifest.sizes[c] > 0)
+            {
+               ifstream is { manifest.files[c],ios::binary };
+               os << is.rdbuf();
+            }
+         }
+         if (!os.flush())
+         {
+            throw runtime_error(target + " cannot be written.");
+         }
+      }
+      else
+      {
+         binary_writer writer { target,F,fused_categories[c],total,extension == ".rle" };
+         for (const auto& manifest : manifests)
+         {
+            append_binary_file(writer,manifest.files[c],F,fused_categories[c],extension == ".rle");
+         }
+         writer.finish();
+      }
+   }
+   for (const auto& manifest : manifests)
+   {
+      for (const auto& file : manifest.files)
+      {
+         filesystem::remove(file);
+      }
+      filesystem::remove(manifest_name(F,manifest.shard));
+   }
+}
+
+/*! Result of a single benchmark case.
+ */
+struct benchmark_result_t
+{
+   /*! Name of the case.
+    */
+   string name;
+   /*! Parameter of the case, for example the sample size k, or - if there is none.
+    */
+   string parameter;
+   /*! Number of independent features.
+    */
+   maxnat_t F;
+   /*! Number of processed items, for example combinations, features, or written lines.
+    */
+   maxnat_t items;
+   /*! Number of calculated bits of difference expressions.
+    */
+   maxnat_t bits;
+   /*! Number of formatted or written bytes.
+    */
+   maxnat_t bytes;
+   /*! Elapsed time in seconds.
+    */
+   double seconds;
+};
+
+/*! Outputs the header of the benchmark results as tab-separated values.
+ *\param os Output stream passed as reference.
+ */
+void print_benchmark_header(ostream& os)
+{
+   os << "case\tparameter\tF\titems\tseconds\tns_per_item\tbits_per_second\tbytes_per_second" << endl;
+}
+
+/*! Outputs a benchmark result as tab-separated values.
+ *\param os Output stream passed as reference.
+ *\param r Benchmark result.
+ */
+void print_benchmark(ostream& os,const benchmark_result_t& r)
+{
+   const double seconds { max(r.seconds,1e-9) };
+   os << r.name << '\t' << r.parameter << '\t' << r.F << '\t' << r.items << '\t'
+      << r.seconds << '\t' << (r.items ? r.seconds * 1e9 / r.items : 0.0) << '\t'
+      << r.bits / seconds << '\t' << r.bytes / seconds << endl;
+}
+
+/*! Measures and returns the time that is required for calling work.
+ *\param work Function to be measured.
+ *\returns Elapsed time in seconds.
+ */
+template <class Work>
+double measure(Work work)
+{
+   const auto start { chrono::steady_clock::now() };
+   work();
+   return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+/*! Exemplars of this class create an empty temporary directory and make it
+ *  the working directory, so that the files written meanwhile do not replace
+ *  files in the previous working directory. The destructor restores the
+ *  previous working directory and removes the temporary directory with all its files.
+ */
+class scratch_directory
+{
+   public:
+      /*! Constructor that creates the temporary directory and changes into it.
+       */
+      scratch_directory()
+         :m_previous { filesystem::current_path() },
+          m_path { filesystem::temp_directory_path() / (prefix + "benchmark_" + to_string(random_device { }())) }
+      {
+         if (!filesystem::create_directory(m_path))
+         {
+            throw runtime_error(m_path.string() + " exists already.");
+         }
+         filesystem::current_path(m_path);
+      }
+      scratch_directory(const scratch_directory&) = delete;
+      scratch_directory& operator=(const scratch_directory&) = delete;
+      /*! Destructor that restores the previous working directory and removes the temporary directory.
+       */
+      ~scratch_directory()
+      {
+         error_code ec;
+         filesystem::current_path(m_previous,ec);
+         filesystem::remove_all(m_path,ec);
+      }
+   private:
+      const filesystem::path m_previous;
+      const filesystem::path m_path;
+};
+
+/*! Returns the total size of the files with the given categories for F
+ *  and removes them.
+ *\param F Number of independent features.
+ *\param extension Extension of the file names, for example ".csv".
+ *\returns Number of bytes.
+ */
+maxnat_t remove_files(maxnat_t F,const string& extension)
+{
+   maxnat_t result { 0 };
+   for (const auto category : { "F","N","A","O","AN","ON" })
+   {
+      const filesystem::path file { prefix + to_string(F) + "_" + category + extension };
+      if (filesystem::exists(file))
+      {
+         result += filesystem::file_size(file);
+         filesystem::remove(file);
+      }
+   }
+   return result;
+}
+
+/*! Runs all benchmark cases for F = first..last and outputs their results.
+ *  The cases measure the enumeration of combinations, the generation of
+ *  difference expressions, the calculation of each category without output,
+ *  and each way of writing the files. The files are written to a scratch_directory,
+ *  so that no file of the working directory is replaced or removed.
+ *\param first Smallest number of independent features.
+ *\param last Largest number of independent features.
+ *\param threads Number of threads for the parallel cases.
+ *\param os Output stream for the results.
+ */
+void run_benchmarks(maxnat_t first,maxnat_t last,unsigned threads,ostream& os)
+{
+   const scratch_directory scratch;
+   print_benchmark_header(os);
+   for (maxnat_t F { first }; F <= last; ++F)
+   {
+      const difference_expression_generator dg(F);
+      const maxnat_t S { dg.S() };
+      maxnat_t combinations { 0 };
+      for (maxnat_t k { 2 }; k <= F; ++k)
+      {
+         combination_t c(F,k);
+         maxnat_t count { 0 };
+         const double seconds { measure([&] () { do { ++count; } while (c.next()); }) };
+         combinations += count;
+         print_benchmark(os,{ "combination_next",to_string(k),F,count,0,0,seconds });
+      }
+      {
+         maxnat_t bits { 0 };
+         const double seconds { measure([&] ()
+                                        {
+                                           for (maxnat_t f { 1 }; f <= F; ++f)
+                                           {
+                                              bits += dg(f).size();
+                                           }
+                                        }) };
+         print_benchmark(os,{ "generator","-",F,F,bits,0,seconds });
+      }
+      const pattern_cache patterns(dg);
+      const array<pair<const char*,pair<operation_t,bool>>,4> categories { {
+         { "A",{ operation_t::conjunction,false } },
+         { "O",{ operation_t::disjunction,false } },
+         { "AN",{ operation_t::conjunction,true } },
+         { "ON",{ operation_t::disjunction,true } } } };
+      for (const auto& [category,evaluation] : categories)
+      {
+         combination_evaluator evaluate(patterns,evaluation.first,evaluation.second);
+         string buffer;
+         maxnat_t bytes { 0 };
+         const double seconds { measure([&] ()
+                                        {
+                                           for (maxnat_t k { 2 }; k <= F; ++k)
+                                           {
+                                              combination_t c(F,k);
+                                              const auto features { c.state() };
+                                              do
+                                              {
+                                                 buffer.clear();
+                                                 append_bits(buffer,evaluate(features),false);
+                                                 bytes += buffer.size();
+                                              } while (c.next());
+                                           }
+                                        }) };
+         print_benchmark(os,{ "compute",category,F,combinations,combinations * S,bytes,seconds });
+      }
+      {
+         const chunk_plan plan(F,chunk_bytes * CHAR_BIT / (S + 1));
+         fused_chunk_formatter format(F,patterns);
+         fused_buffer_t buffer;
+         maxnat_t bytes { 0 };
+         const double seconds { measure([&] ()
+                                        {
+                                           for (maxnat_t i { 0 }; i < plan.size(); ++i)
+                                           {
+                                              format(plan[i],buffer);
+                                              for (const auto& d : buffer.data)
+                                              {
+                                                 bytes += d.size();
+                                              }
+                                           }
+                                        }) };
+         print_benchmark(os,{ "compute","fused",F,combinations,4 * combinations * S,bytes,seconds });
+      }
+      const array<pair<const char*,void (*)(const difference_expression_generator&)>,6> writers { {
+         { "F",print_independent_features },
+         { "N",print_not_features },
+         { "A",print_and_features },
+         { "O",print_or_features },
+         { "AN",print_and_not_features },
+         { "ON",print_or_not_features } } };
+      for (const auto& [category,print] : writers)
+      {
+         const double seconds { measure([&] () { print(dg); }) };
+         const maxnat_t items { category == "F"s || category == "N"s ? F : combinations };
+         print_benchmark(os,{ "write",category,F,items,items * S,remove_files(F,".csv"),seconds });
+      }
+      // The positional engine is only available on Unix-like systems.
+      const vector<pair<string,function<void ()>>> engines { {
+         { "fused",[&] () { print_fused_features(dg); } },
+         { "parallel",[&] () { print_fused_features_parallel(dg,threads); } },
+#if defined(__unix__) || defined(__APPLE__)
+         { "positional",[&] () { print_fused_features_positional(dg,threads); } },
+#endif
+         { "tiled",[&] () { print_tiled_features(dg); } },
+         { "binary",[&] () { print_fused_features_binary(dg,threads); } } } };
+      for (const auto& [engine,print] : engines)
+      {
+         const double seconds { measure(print) };
+         const maxnat_t bytes { remove_files(F,".csv") + remove_files(F,".bin") };
+         // Items are the lines or records written. The tiled engine writes
+         // the independent and not features, too.
+         const maxnat_t items { engine == "tiled" ? 4 * combinations + 2 * F : 4 * combinations },
+                        bits { items * S };
+         print_benchmark(os,{ "write",engine,F,items,bits,bytes,seconds });
+      }
    }
 }
 
-/*! Outputs difference expressions for or-not features to a file.
- * This implementation creates and uses difference expressions.
- *\param dg Difference generator to be used for generating difference expressions.
+/*! Returns the decimal representation of n.
+ *\param n Natural number.
+ *\returns Decimal digits as string.
  */
-void print_or_not_features(const difference_expression_generator& dg)
+string wide_to_string(wide_t n)
+{
+   string result;
+   do
+   {
+      result.push_back(static_cast<char>('0' + n % 10));
+      n /= 10;
+   } while (n);
+   reverse(result.begin(),result.end());
+   return result;
+}
+
+/*! Engines of the program, which are selected by the command line arguments.
+ */
+enum class engine_t : unsigned char
 {
-   ofstream os { prefix + to_string(dg.F()) + "_ON.csv" };
+   fused,
+   parallel,
+   positional,
+   tiled,
+   binary,
+   incremental
+};
 
-   for (maxnat_t f { 2 }; f <= dg.F(); ++f)
+/*! All engines in the order of engine_t.
+ */
+constexpr array<engine_t,6> engines { engine_t::fused,engine_t::parallel,engine_t::positional,
+                                      engine_t::tiled,engine_t::binary,engine_t::incremental };
+
+/*! Names of the engines in the order of engine_t, as used by the benchmark cases.
+ */
+const array<string,6> engine_names { "fused","parallel","positional","tiled","binary","incremental" };
+
+/*! Seconds per bit of difference expressions written by each engine in the order of engine_t.
+ *  The default values have been measured with an optimized build. They may be
+ *  replaced by the results of --benchmark, see read_calibration().
+ */
+struct calibration_t
+{
+   array<double,6> seconds_per_bit { 2e-9,1.6e-9,1.6e-9,2.6e-9,1e-10,1e-10 };
+};
+
+/*! Returns a calibration that is read from the results of --benchmark.
+ *  For each engine, the write case with the largest F determines the
+ *  seconds per bit. The incremental engine uses the value of the binary engine.
+ *\param is Input stream with tab-separated benchmark results.
+ *\returns Calibration as value.
+ */
+calibration_t read_calibration(istream& is)
+{
+   calibration_t result { };
+   array<maxnat_t,6> largest { };
+   string line;
+   while (getline(is,line))
    {
-      combination_t c(dg.F(),f);
-      do
+      istringstream fields { line };
+      string name,
+             engine;
+      maxnat_t F { },
+               items { };
+      double seconds { },
+             ns_per_item { },
+             bits_per_second { };
+      if (!getline(fields,name,'\t') || name != "write" || !getline(fields,engine,'\t') ||
+          !(fields >> F >> items >> seconds >> ns_per_item >> bits_per_second) || bits_per_second <= 0)
+      {
+         continue;
+      }
+      for (maxnat_t e { 0 }; e < engine_names.size(); ++e)
       {
-         auto features { c() };
-         auto result { ~dg(features.at(0) + 1) };
-         string i { "!f"s + to_string(features.at(0) + 1) };
-         for (maxnat_t e { 1 }; e < features.size(); ++ e)
+         if (engine_names[e] == engine && F >= largest[e])
          {
-            result |= ~dg(features.at(e) + 1);
-            i += ("+!f"s + to_string(features.at(e) + 1));
+            largest[e] = F;
+            result.seconds_per_bit[e] = 1 / bits_per_second;
+            if (engines[e] == engine_t::binary)
+            {
+               result.seconds_per_bit[static_cast<maxnat_t>(engine_t::incremental)] = 1 / bits_per_second;
+            }
          }
-         os << i << '\t' << result << endl;
-      } while (c.next());
+      }
+   }
+   return result;
+}
+
+/*! Returns the physical memory of the computer.
+ *\returns Number of bytes, or 0 if it is not available.
+ */
+maxnat_t physical_memory()
+{
+#if defined(__unix__) || defined(__APPLE__)
+   const long pages { sysconf(_SC_PHYS_PAGES) },
+              page_size { sysconf(_SC_PAGE_SIZE) };
+   if (pages > 0 && page_size > 0)
+   {
+      return static_cast<maxnat_t>(pages) * static_cast<maxnat_t>(page_size);
+   }
+#endif
+   return 0;
+}
+
+/*! Exemplars of this class plan a run with F independent features before it
+ *  is started. The numbers of features and the sizes of the files are calculated
+ *  exactly in closed form, the peak memory and the runtime are estimated.
+ */
+class capacity_plan
+{
+   public:
+      /*! A capacity plan exemplar must be initialized with the number
+       *  of independent features, the number of threads, and a calibration.
+       *\param F Number of independent features, which must be less than 64.
+       *\param threads Number of threads.
+       *\param calibration Seconds per bit of each engine.
+       */
+      capacity_plan(maxnat_t F,unsigned threads,const calibration_t& calibration = { })
+         :m_F { F },m_threads { max(threads,1u) },m_calibration { calibration }
+      {
+         if (F == 0 || F >= 64)
+         {
+            throw domain_error("F must be in the range 1..63.");
+         }
+         m_S = wide_t { 1 } << F;
+         m_combinations = m_S - F - 1;
+         m_stride = ceil_div(static_cast<maxnat_t>(m_S),word_bits) * sizeof(word_t);
+         for (maxnat_t i { 1 }; i <= F; ++i)
+         {
+            m_digits += digits(i);
+         }
+      }
+      /*! Returns number of systems.
+       *\returns S = 2^F.
+       */
+      wide_t S() const
+      {
+         return m_S;
+      }
+      /*! Returns number of features of each category with at least two independent features.
+       *\returns 2^F - F - 1.
+       */
+      wide_t combinations() const
+      {
+         return m_combinations;
+      }
+      /*! Returns number of features of a category.
+       *\param category Symbol of feature category.
+       *\returns F for F and N, and combinations() otherwise.
+       */
+      wide_t features(const string& category) const
+      {
+         return category == "F" || category == "N" ? wide_t { m_F } : m_combinations;
+      }
+      /*! Returns the total length of the names of all features of a category.
+       *  Each independent feature occurs in 2^(F - 1) - 1 combinations with k >= 2,
+       *  which contain 2^(F - 1) * F - 2^F + 1 operators.
+       *\param category Symbol of feature category.
+       *\returns Number of bytes.
+       */
+      wide_t name_bytes(const string& category) const
+      {
+         const wide_t letters { category.front() == 'N' || category.size() == 2 ? 2u : 1u };
+         if (category == "F" || category == "N")
+         {
+            return letters * m_F + m_digits;
+         }
+         const wide_t occurrences { m_S / 2 - 1 },
+                      operators { m_S / 2 * m_F - m_S + 1 };
+         return letters * m_F * occurrences + occurrences * m_digits + operators;
+      }
+      /*! Returns the size of the CSV file of a category.
+       *\param category Symbol of feature category.
+       *\returns Number of bytes.
+       */
+      wide_t csv_bytes(const string& category) const
+      {
+         // Each line consists of name, tab, S bits, and newline.
+         return name_bytes(category) + features(category) * (m_S + 2);
+      }
+      /*! Returns the size of the binary file of a category.
+       *\param category Symbol of feature category.
+       *\returns Number of bytes.
+       */
+      wide_t binary_bytes(const string& category) const
+      {
+         return sizeof(binary_header_t) + features(category) * m_stride +
+                (features(category) + 1) * sizeof(uint64_t) + name_bytes(category);
+      }
+      /*! Returns the total size of the files written by an engine.
+       *\param engine Engine.
+       *\returns Number of bytes.
+       */
+      wide_t output_bytes(engine_t engine) const
+      {
+         wide_t result { 0 };
+         for (const auto category : { "F","N","A","O","AN","ON" })
+         {
+            result += binary(engine) ? binary_bytes(category) : csv_bytes(category);
+         }
+         return result;
+      }
+      /*! Returns the estimated peak memory of an engine.
+       *\param engine Engine.
+       *\returns Number of bytes.
+       */
+      wide_t memory(engine_t engine) const
+      {
+         const wide_t longest_name { m_F * (3 + digits(m_F)) },
+                      line { m_S + 2 + longest_name },
+                      // Patterns and negated patterns, and partial results of two evaluators.
+                      patterns { 2 * m_F * m_stride },
+                      evaluators { 2 * m_F * m_stride },
+                      // Each thread owns a buffer, and 2 * threads buffers are pending.
+                      buffers { 3 * m_threads },
+                      text_chunk { 4 * max(wide_t { chunk_bytes } / (m_S + 1),wide_t { 1 }) * line },
+                      binary_chunk { 4 * max(wide_t { chunk_bytes * CHAR_BIT } / (m_S + 1),wide_t { 1 }) *
+                                     (m_stride + longest_name) },
+                      // binary_writer collects the names and their positions until the end.
+                      names { name_bytes("A") + name_bytes("O") + name_bytes("AN") + name_bytes("ON") +
+                              4 * (m_combinations + 1) * sizeof(uint64_t) },
+                      // Each async_ofstream owns a ring of blocks.
+                      writer { async_blocks * async_block_size };
+         switch (engine)
+         {
+            case engine_t::fused:
+               return patterns + evaluators + 4 * line + 4 * writer;
+            case engine_t::parallel:
+               return patterns + m_threads * evaluators + buffers * text_chunk + 4 * writer;
+            case engine_t::positional:
+               return patterns + m_threads * evaluators + buffers * text_chunk;
+            case engine_t::tiled:
+               return 6 * tile_words * sizeof(word_t) + tile_words * word_bits + 6 * longest_name + 6 * writer;
+            case engine_t::binary:
+               return patterns + m_threads * evaluators + buffers * binary_chunk + names;
+            case engine_t::incremental:
+               return 4 * m_stride + names;
+         }
+         return 0;
+      }
+      /*! Returns the estimated runtime of an engine.
+       *\param engine Engine.
+       *\returns Seconds.
+       */
+      double seconds(engine_t engine) const
+      {
+         return static_cast<double>(4 * m_combinations * m_S) *
+                m_calibration.seconds_per_bit[static_cast<maxnat_t>(engine)];
+      }
+      /*! Checks whether an engine can finish. It cannot, if its estimated
+       *  memory exceeds the physical memory, or if its files do not fit into
+       *  the available space of the working directory.
+       *  A shard of several is estimated to require the corresponding share
+       *  of the files and the runtime.
+       *\param engine Engine.
+       *\param shards Number of shards.
+       *\returns Pair of true if the engine can finish and false otherwise,
+       *  and the reason, which is a warning if the engine can finish.
+       */
+      pair<bool,string> check(engine_t engine,maxnat_t shards = 1) const
+      {
+         error_code ec;
+         const auto space { filesystem::space(".",ec) };
+         const wide_t bytes { output_bytes(engine) / shards };
+         const double runtime { seconds(engine) / shards };
+         if (const auto memory_limit { physical_memory() }; memory_limit && memory(engine) > memory_limit)
+         {
+            return { false,"The estimated memory of " + wide_to_string(memory(engine)) +
+                           " bytes exceeds the physical memory of " + to_string(memory_limit) + " bytes." };
+         }
+         if (!ec && bytes > space.available)
+         {
+            return { false,"The files of " + wide_to_string(bytes) +
+                           " bytes exceed the available space of " + to_string(space.available) + " bytes." };
+         }
+         if (runtime > 3600)
+         {
+            return { true,"The estimated runtime is " + to_string(runtime) + " seconds." };
+         }
+         return { true,"" };
+      }
+      /*! Outputs the plan with one value per line followed by its name and its description.
+       *\param os Output stream passed as reference.
+       */
+      void print(ostream& os) const
+      {
+         os << m_F << "\tF\tnumber of independent features\n"
+            << wide_to_string(m_S) << "\tS\tnumber of systems\n"
+            << wide_to_string(m_combinations) << "\tC\tnumber of features of each category except F and N\n";
+         for (const auto category : { "F","N","A","O","AN","ON" })
+         {
+            const string file { prefix + to_string(m_F) + "_" + category };
+            os << wide_to_string(csv_bytes(category)) << '\t' << file << ".csv\tbytes of CSV file\n"
+               << wide_to_string(binary_bytes(category)) << '\t' << file << ".bin\tbytes of binary file\n";
+         }
+         for (const auto engine : engines)
+         {
+            const auto& name { engine_names[static_cast<maxnat_t>(engine)] };
+            const auto [feasible,reason] { check(engine) };
+            os << wide_to_string(memory(engine)) << "\tmemory_" << name << "\testimated peak memory in bytes\n"
+               << seconds(engine) << "\tseconds_" << name << "\testimated runtime in seconds\n"
+               << (feasible ? (reason.empty() ? "feasible" : "slow") : "infeasible")
+               << "\tstatus_" << name << '\t' << reason << '\n';
+         }
+      }
+   private:
+      /*! Returns true if an engine writes binary files.
+       *\param engine Engine.
+       *\returns True for binary and incremental.
+       */
+      static bool binary(engine_t engine)
+      {
+         return engine == engine_t::binary || engine == engine_t::incremental;
+      }
+      const maxnat_t m_F;
+      const unsigned m_threads;
+      const calibration_t m_calibration;
+      wide_t m_S { },
+             m_combinations { },
+             m_stride { },
+             m_digits { };
+};
+
+/*! Calculates and returns the symbolic expression of a feature name in the
+ *  format of the files, that is, independent features with ascending feature-ids,
+ *  which are either all negated or not, joined by either * or +, for example
+ *  f1*f3, !f2+!f5, or f4.
+ *\param sg Symbolic expression generator passed as reference.
+ *\param name Name of feature.
+ *\returns Root node of expression.
+ */
+symbolic_expression_generator::node_t parse_feature(symbolic_expression_generator& sg,const string& name)
+{
+   const string error { name + " is not a feature name for F = " + to_string(sg.F()) + "." };
+   symbolic_expression_generator::node_t result { };
+   char op { '\0' };
+   maxnat_t previous { 0 };
+   bool negated_terms { false };
+   const char* p { name.data() };
+   const char* const end { name.data() + name.size() };
+   for (;;)
+   {
+      const bool negated { p < end && *p == '!' };
+      if (previous > 0 && negated != negated_terms)
+      {
+         throw invalid_argument(error);
+      }
+      negated_terms = negated;
+      p += negated;
+      if (p == end || *p != 'f')
+      {
+         throw invalid_argument(error);
+      }
+      maxnat_t f { 0 };
+      const auto [next,ec] { from_chars(p + 1,end,f) };
+      if (ec != errc { } || f <= previous || f > sg.F())
+      {
+         throw invalid_argument(error);
+      }
+      previous = f;
+      p = next;
+      const auto term { negated ? sg.negation(sg(f)) : sg(f) };
+      result = op == '\0' ? term : sg.apply(op == '*' ? operation_t::conjunction : operation_t::disjunction,result,term);
+      if (p == end)
+      {
+         return result;
+      }
+      if ((*p != '*' && *p != '+') || (op != '\0' && *p != op))
+      {
+         throw invalid_argument(error);
+      }
+      op = *p++;
+   }
+}
+
+/*! Evaluates features symbolically, so that F may be up to 64, and outputs
+ *  a line for each with its name, the number of systems to be intersected,
+ *  and the number of systems to be united, followed by its values for the
+ *  given systems (1 if the system is to be intersected), all separated by tabs.
+ *  If expand is true, the difference expressions are additionally expanded to
+ *  bit strings and written to fl_ followed by F and _Q.csv like the other CSV files.
+ *  Before anything is output, throws invalid_argument for an invalid name or system,
+ *  and length_error if expand is true and the difference expressions do not fit into memory.
+ *\param os Output stream passed as reference.
+ *\param F Number of independent features.
+ *\param names Names of features.
+ *\param systems System-ids (1..S) whose values are output.
+ *\param expand True if the difference expressions are to be written to a file.
+ */
+void print_queries(ostream& os,maxnat_t F,const vector<string>& names,const vector<maxnat_t>& systems,bool expand)
+{
+   symbolic_expression_generator sg(F);
+   const wide_t S { wide_t { 1 } << F };
+   vector<symbolic_expression_generator::node_t> expressions;
+   for (const auto& name : names)
+   {
+      expressions.push_back(parse_feature(sg,name));
+   }
+   for (const auto s : systems)
+   {
+      if (s == 0 || s > S)
+      {
+         throw invalid_argument("System " + to_string(s) + " does not exist for F = " + to_string(F) + ".");
+      }
+   }
+   if (const auto memory_limit { physical_memory() };
+       expand && (F >= word_bits || (memory_limit && S / CHAR_BIT > memory_limit)))
+   {
+      throw length_error("The difference expressions for F = " + to_string(F) + " do not fit into memory.");
+   }
+   for (maxnat_t i { 0 }; i < names.size(); ++i)
+   {
+      const wide_t intersected { sg.count(expressions[i]) };
+      os << names[i] << '\t' << wide_to_string(intersected) << '\t' << wide_to_string(S - intersected);
+      for (const auto s : systems)
+      {
+         os << '\t' << sg.value(expressions[i],s - 1);
+      }
+      os << '\n';
+   }
+   if (expand)
+   {
+      async_ofstream file { prefix + to_string(F) + "_Q.csv" };
+      string line;
+      for (maxnat_t i { 0 }; i < names.size(); ++i)
+      {
+         write_line(file,line,names[i],sg.expand(expressions[i]),false);
+      }
+      file.close();
+   }
+}
+
+/*! Options of the program that are provided as command line arguments.
+ */
+struct options_t
+{
+   /*! Number of independent features, 0 if it is to be read from cin.
+    */
+   maxnat_t F { 0 };
+   /*! Number of threads for calculating difference expressions.
+    */
+   unsigned threads { 1 };
+   /*! True if the threads write their results directly into preallocated files.
+    */
+   bool positional { false };
+   /*! True if the files are written in the binary format instead of as CSV.
+    */
+   bool binary { false };
+   /*! True if the files are written in the compressed variant of the binary format.
+    */
+   bool compressed { false };
+   /*! True if the binary files are derived from those for F - 1.
+    */
+   bool incremental { false };
+   /*! True if the system axis is processed in tiles with constant memory.
+    */
+   bool tiled { false };
+   /*! True if the benchmark cases are run for F = 1..F instead of writing the files.
+    */
+   bool benchmark { false };
+   /*! True if the capacity plan is printed instead of writing the files.
+    */
+   bool dry_run { false };
+   /*! Name of a file with benchmark results for the runtime estimates, or empty.
+    */
+   string calibration_file { };
+   /*! Directory of a result_cache for the binary and compressed files, or empty.
+    */
+   string cache_directory { };
+   /*! Shard of the combinations that is calculated.
+    */
+   shard_t shard { };
+   /*! Number of shards whose files are merged instead of writing the files, or 0.
+    */
+   maxnat_t merge { 0 };
+   /*! Names of features that are evaluated symbolically instead of writing the files.
+    */
+   vector<string> queries { };
+   /*! System-ids whose values are output for each query.
+    */
+   vector<maxnat_t> systems { };
+   /*! True if the difference expressions of the queries are written to a file.
+    */
+   bool expand { false };
+};
+
+/*! Returns options that are parsed from command line arguments.
+ * Usage: fl [F] [--threads N] [--positional | --binary | --compressed | --incremental | --tiled | --benchmark]
+ *           [--dry-run] [--calibration FILE] [--cache DIR] [--shard i/N | --merge N]
+ *           [--query NAME]... [--system s]... [--expand]
+ * With --threads 0, the number of hardware threads is used.
+ * With --incremental, the binary files are derived from those for F - 1.
+ * With --cache, binary and compressed files are copied from DIR if they exist there, or into DIR otherwise.
+ * With --shard i/N, only the i-th of N shards of the combinations is calculated (1 <= i <= N).
+ * With --merge N, the files of N shards are merged.
+ * With --query, the named features are evaluated symbolically for F up to 64.
+ *\param argc Number of arguments.
+ *\param argv Arguments.
+ *\returns Options as value.
+ */
+options_t parse_options(int argc,char* argv[])
+{
+   options_t result { };
+   for (int i { 1 }; i < argc; ++i)
+   {
+      const string argument { argv[i] };
+      if (argument == "--threads" && i + 1 < argc)
+      {
+         result.threads = stoul(argv[++i]);
+         if (result.threads == 0)
+         {
+            result.threads = max(thread::hardware_concurrency(),1u);
+         }
+      }
+      else if (argument == "--positional")
+      {
+         result.positional = true;
+      }
+      else if (argument == "--binary")
+      {
+         result.binary = true;
+      }
+      else if (argument == "--compressed")
+      {
+         result.compressed = true;
+      }
+      else if (argument == "--incremental")
+      {
+         result.incremental = true;
+      }
+      else if (argument == "--tiled")
+      {
+         result.tiled = true;
+      }
+      else if (argument == "--benchmark")
+      {
+         result.benchmark = true;
+      }
+      else if (argument == "--dry-run")
+      {
+         result.dry_run = true;
+      }
+      else if (argument == "--calibration" && i + 1 < argc)
+      {
+         result.calibration_file = argv[++i];
+      }
+      else if (argument == "--cache" && i + 1 < argc)
+      {
+         result.cache_directory = argv[++i];
+      }
+      else if (argument == "--shard" && i + 1 < argc)
+      {
+         const string value { argv[++i] };
+         const auto slash { value.find('/') };
+         if (slash == string::npos)
+         {
+            throw invalid_argument("--shard requires i/N");
+         }
+         result.shard = { stoull(value.substr(0,slash)),stoull(value.substr(slash + 1)) };
+         if (result.shard.index == 0 || result.shard.index > result.shard.count)
+         {
+            throw invalid_argument("--shard requires 1 <= i <= N");
+         }
+      }
+      else if (argument == "--merge" && i + 1 < argc)
+      {
+         result.merge = stoull(argv[++i]);
+      }
+      else if (argument == "--query" && i + 1 < argc)
+      {
+         result.queries.push_back(argv[++i]);
+      }
+      else if (argument == "--system" && i + 1 < argc)
+      {
+         result.systems.push_back(stoull(argv[++i]));
+      }
+      else if (argument == "--expand")
+      {
+         result.expand = true;
+      }
+      else if (!argument.empty() && argument.front() != '-')
+      {
+         result.F = stoull(argument);
+      }
+      else
+      {
+         throw invalid_argument("Unknown argument " + argument);
+      }
+   }
+   return result;
+}
+
+/*! Writes the files of all categories for F independent features
+ *  with the engine selected by options.
+ *\param F Number of independent features.
+ *\param options Options of the program.
+ */
+void write_files(maxnat_t F,const options_t& options)
+{
+   // Number of lines or records of each file of or-, and-, or-not-, and and-not-features.
+   const maxnat_t combinations { power(2,F) - F - 1 };
+   const difference_expression_generator dg { instrumentation.run_phase("generate_difference_expressions",F,0,{ },"",
+                                                                        [F] () { return difference_expression_generator(F); }) };
+   if (options.incremental)
+   {
+      instrumentation.run_phase("independent_and_not_features_binary",F,2 * F,{ "F","N" },".bin",
+                                [&] () { print_independent_and_not_features_binary(dg); });
+      instrumentation.run_phase("fused_features_incremental",F,4 * combinations,{ "A","O","AN","ON" },".bin",
+                                [&] () { print_fused_features_incremental(dg); });
+   }
+   else if (options.tiled)
+   {
+      instrumentation.run_phase("tiled_features",F,2 * F + 4 * combinations,{ "F","N","A","O","AN","ON" },".csv",
+                                [&] () { print_tiled_features(dg); });
+   }
+   else if (options.binary || options.compressed)
+   {
+      const char* extension { options.compressed ? ".rle" : ".bin" };
+      if (options.shard.index == 1)
+      {
+         instrumentation.run_phase("independent_and_not_features_binary",F,2 * F,{ "F","N" },extension,
+                                   [&] () { print_independent_and_not_features_binary(dg,options.compressed); });
+      }
+      instrumentation.run_phase("fused_features_binary",F,4 * options.shard.size(combinations),{ "A","O","AN","ON" },
+                                (options.shard.suffix() + extension).c_str(),
+                                [&] () { print_fused_features_binary(dg,options.threads,options.compressed,options.shard); });
+   }
+   else
+   {
+      if (options.shard.index == 1)
+      {
+         // If you uncomment the next line, you should de-comment the over-next line
+         instrumentation.run_phase("independent_features",F,F,{ "F" },".csv",[&] () { print_independent_features(dg); });
+//         print_independent_features_alt(dg);
+         instrumentation.run_phase("not_features",F,F,{ "N" },".csv",[&] () { print_not_features(dg); });
+      }
+      // If you uncomment the next four lines, you should de-comment the print_fused_features* calls after them,
+      // which write the same four files in one pass
+//      print_and_features(dg);
+//      print_or_features(dg);
+//      print_and_not_features(dg);
+//      print_or_not_features(dg);
+#if defined(__unix__) || defined(__APPLE__)
+      if (options.positional)
+      {
+         instrumentation.run_phase("fused_features_positional",F,4 * combinations,{ "A","O","AN","ON" },".csv",
+                                   [&] () { print_fused_features_positional(dg,options.threads); });
+      }
+      else
+#endif
+      if (options.threads > 1 || options.shard.count > 1)
+      {
+         instrumentation.run_phase("fused_features_parallel",F,4 * options.shard.size(combinations),
+                                   { "A","O","AN","ON" },(options.shard.suffix() + ".csv").c_str(),
+                                   [&] () { print_fused_features_parallel(dg,options.threads,options.shard); });
+      }
+      else
+      {
+         instrumentation.run_phase("fused_features",F,4 * combinations,{ "A","O","AN","ON" },".csv",
+                                   [&] () { print_fused_features(dg); });
+      }
    }
 }
 
-int main()
+int main(int argc,char* argv[])
 {
-   maxnat_t F { };
-   cout << "F = " << flush;
-   cin >> F;
+   const options_t options { parse_options(argc,argv) };
+   maxnat_t F { options.F };
+   if (F == 0)
+   {
+      cout << "F = " << flush;
+      cin >> F;
+   }
 
-   difference_expression_generator dg(F);
-   // If you uncomment the next line, you should de-comment the over-next line
-   print_independent_features(dg);
-//   print_independent_features_alt(dg);
-   print_not_features(dg);
-   print_and_features(dg);
-   print_or_features(dg);
-   print_and_not_features(dg);
-   print_or_not_features(dg);
+   if (options.benchmark)
+   {
+      run_benchmarks(2,F,options.threads,cout);
+      return 0;
+   }
+   if (options.merge > 0)
+   {
+      merge_shards(F,options.merge);
+      return 0;
+   }
+   if (!options.queries.empty())
+   {
+      try
+      {
+         print_queries(cout,F,options.queries,options.systems,options.expand);
+      }
+      catch (const logic_error& e)
+      {
+         cerr << "Refused: " << e.what() << endl;
+         return 1;
+      }
+      return 0;
+   }
+   calibration_t calibration { };
+   if (!options.calibration_file.empty())
+   {
+      ifstream is { options.calibration_file };
+      calibration = read_calibration(is);
+   }
+   const capacity_plan plan(F,options.threads,calibration);
+   if (options.dry_run)
+   {
+      plan.print(cout);
+      return 0;
+   }
+   const engine_t engine { options.incremental ? engine_t::incremental :
+                           options.tiled ? engine_t::tiled :
+                           options.binary || options.compressed ? engine_t::binary :
+                           options.positional ? engine_t::positional :
+                           options.threads > 1 ? engine_t::parallel : engine_t::fused };
+   if (options.shard.count > 1 && engine != engine_t::binary && engine != engine_t::parallel && engine != engine_t::fused)
+   {
+      cerr << "Refused: --shard requires the fused, parallel, or binary engine." << endl;
+      return 1;
+   }
+   if (const auto [feasible,reason] { plan.check(engine,options.shard.count) }; !feasible)
+   {
+      cerr << "Refused: " << reason << endl;
+      return 1;
+   }
+   else if (!reason.empty())
+   {
+      cerr << "Warning: " << reason << endl;
+   }
+   const char* extension { engine == engine_t::binary ? (options.compressed ? ".rle" : ".bin") :
+                           engine == engine_t::incremental ? ".bin" : ".csv" };
+   optional<result_cache> cache { };
+   if (!options.cache_directory.empty() && options.shard.count == 1 &&
+       (engine == engine_t::incremental || engine == engine_t::binary))
+   {
+      cache.emplace(options.cache_directory);
+   }
+   if (!cache || !instrumentation.run_phase("read_cache",F,0,{ "F","N","A","O","AN","ON" },extension,
+                                            [&] () { return cache->restore(F,{ "F","N","A","O","AN","ON" },extension); }))
+   {
+      write_files(F,options);
+      if (cache)
+      {
+         cache->store(F,{ "F","N","A","O","AN","ON" },extension);
+      }
+      if (options.shard.count > 1)
+      {
+         write_manifest(F,options.shard,extension);
+      }
+   }
+   if constexpr (instrumenting)
+   {
+      ofstream report { prefix + to_string(F) + "_report.json" };
+      instrumentation.print_json(report,F);
+   }
 }